@@ -0,0 +1,114 @@
+/*******************************************************************************************************
+											 HEADER FILES
+*******************************************************************************************************/
+
+#include "clock.h"
+
+/*******************************************************************************************************
+									   GLOBAL VARIABLES AND ISRs
+*******************************************************************************************************/
+
+volatile uint32_t clock_overflows;		//Timer2 overflows since clock_init
+volatile uint32_t clock_millis;			//Milliseconds since clock_init
+volatile uint16_t clock_fract;			//Microseconds not yet counted in clock_millis
+
+ISR( TIMER2_OVF_vect )
+{
+	uint32_t ms = clock_millis + CLOCK_MS_PER_OVF;
+	uint16_t fract = clock_fract + CLOCK_FRACT_PER_OVF;
+
+	if ( fract >= 1000 )
+	{
+		fract -= 1000;
+		ms += 1;
+	}
+
+	clock_millis = ms;
+	clock_fract = fract;
+	clock_overflows += 1;
+}
+
+/*******************************************************************************************************
+										  FUNCTION DEFINITIONS
+*******************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------
+	Function starts Timer2 as free running time base
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	clock_init
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void clock_init(void)
+{
+	TCCR2 = 0x00;
+	TCNT2 = 0;
+	TIFR = ( 1 << TOV2 );				//Clearing stale overflow
+	TCCR2 = CLOCK_TIMER_START;			//Normal mode, counting up to 0xFF
+
+	TIMSK |= ( 1 << TOIE2 );
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function returns milliseconds elapsed since clock_init
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	millis
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	Milliseconds, wraps after 49.7 days
+*-------------------------------------------------------------------------------------------------------*/
+
+uint32_t millis(void)
+{
+	uint32_t ms;
+	uint8_t sreg = SREG;
+
+	cli();				//32 bit count is updated by ISR
+	ms = clock_millis;
+	SREG = sreg;
+
+	return ms;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function returns microseconds elapsed since clock_init
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	micros
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	Microseconds with resolution of one timer count, wraps after 71.6 minutes
+*-------------------------------------------------------------------------------------------------------*/
+
+uint32_t micros(void)
+{
+	uint32_t ovf;
+	uint8_t count;
+	uint8_t sreg = SREG;
+
+	cli();
+
+	ovf = clock_overflows;
+	count = TCNT2;
+
+	//Timer2 overflowed after interrupts were disabled, ISR has not counted it yet
+	if ( ( TIFR & ( 1 << TOV2 ) ) && ( count < 255 ) )
+	{
+		ovf += 1;
+	}
+
+	SREG = sreg;
+
+	return ( ( ovf << 8 ) + count ) * CLOCK_US_PER_COUNT;
+}
+
+/*********************************************************************************************************/
@@ -0,0 +1,45 @@
+#ifndef CLOCK_H
+#define CLOCK_H
+
+/*********************************************************************************************************
+											 HEADER FILES
+*********************************************************************************************************/
+
+#ifndef F_CPU
+#define F_CPU	8000000UL	//Setting clock at 8MHz
+#endif
+
+#include <stdint.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+#include "timer.h"
+
+/*********************************************************************************************************
+									  	   MACRO DEFINITIONS
+*********************************************************************************************************/
+
+/*	Timer2 runs free with prescaler 64, one count is 8us and one overflow 2048us at 8MHz.
+ *	Overflows are counted in software to extend the 8 bit timer to 32 bits.			*/
+#define CLOCK_PRESCALER			64
+#define CLOCK_TIMER_START		TIMER2_CS_64
+#define CLOCK_US_PER_COUNT		( CLOCK_PRESCALER / ( F_CPU / 1000000UL ) )
+#define CLOCK_US_PER_OVF		( 256UL * CLOCK_US_PER_COUNT )
+#define CLOCK_MS_PER_OVF		( CLOCK_US_PER_OVF / 1000 )
+#define CLOCK_FRACT_PER_OVF		( CLOCK_US_PER_OVF % 1000 )		//us carried to millis on each overflow
+
+#if ( F_CPU % 1000000UL ) || ( CLOCK_PRESCALER % ( F_CPU / 1000000UL ) )
+#error "F_CPU has to be a whole number of MHz dividing 64 for an exact microsecond clock"
+#endif
+
+/*******************************************************************************************************
+										  FUNCTION PROTOTYPES
+*******************************************************************************************************/
+
+void clock_init(void);
+uint32_t millis(void);
+uint32_t micros(void);
+
+/*********************************************************************************************************/
+
+#endif
@@ -0,0 +1,157 @@
+/*******************************************************************************************************
+											 HEADER FILES
+*******************************************************************************************************/
+
+#include "i2c.h"
+
+/*******************************************************************************************************
+										    GLOBAL VARIABLES
+*******************************************************************************************************/
+
+I2C_stats i2c_stats;						//Bus error counters, recovery and transfer times
+
+/*******************************************************************************************************
+										  FUNCTION DEFINITIONS
+*******************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------
+	Function waits until a submitted transaction ends, stuck transactions are ended by watchdog
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	i2c_wait
+*
+*   Parameters 		:  	I2C_xfer *xfer	-	Submitted transaction
+*
+*   Return     		: 	PASS or FAIL
+*-------------------------------------------------------------------------------------------------------*/
+
+int i2c_wait( I2C_xfer *xfer )
+{
+	while ( xfer->status == I2C_PENDING )
+	{
+		i2c_watchdog();
+	}
+
+	return ( xfer->status == I2C_DONE ) ? PASS : FAIL;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function writes a block of consecutive device registers in one transaction
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	i2c_write_regs
+*
+*   Parameters 		:  	uint8_t dev			-	Slave address with write bit
+*						uint8_t reg			-	Address of first register
+*						const uint8_t *buf	-	Register values
+*						uint8_t n			-	Number of registers, at most I2C_BURST_MAX
+*
+*   Return     		: 	PASS or FAIL
+*-------------------------------------------------------------------------------------------------------*/
+
+int i2c_write_regs( uint8_t dev, uint8_t reg, const uint8_t *buf, uint8_t n )
+{
+	uint8_t frame[1 + I2C_BURST_MAX];		//Register address followed by values, sent in one write phase
+	I2C_xfer xfer = { dev, frame, n + 1, NULL, 0, NULL, I2C_IDLE };
+	uint8_t itr;
+
+	if ( n > I2C_BURST_MAX )
+	{
+		return FAIL;
+	}
+
+	frame[0] = reg;
+	for (itr = 0; itr < n; itr += 1)
+	{
+		frame[itr + 1] = buf[itr];
+	}
+
+	if ( i2c_submit( &xfer ) == FAIL )
+	{
+		return FAIL;
+	}
+
+	return i2c_wait( &xfer );
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function reads a block of consecutive device registers, register address is followed by repeated START
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	i2c_read_regs
+*
+*   Parameters 		:  	uint8_t dev		-	Slave address with write bit
+*						uint8_t reg		-	Address of first register
+*						uint8_t *buf	-	Receives register values
+*						uint8_t n		-	Number of registers
+*
+*   Return     		: 	PASS or FAIL
+*-------------------------------------------------------------------------------------------------------*/
+
+int i2c_read_regs( uint8_t dev, uint8_t reg, uint8_t *buf, uint8_t n )
+{
+	I2C_xfer xfer = { dev, &reg, 1, buf, n, NULL, I2C_IDLE };
+
+	if ( i2c_submit( &xfer ) == FAIL )
+	{
+		return FAIL;
+	}
+
+	return i2c_wait( &xfer );
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function frees a bus held by a slave and records how long it took
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	I2C_bus_recover
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void I2C_bus_recover(void)
+{
+	uint32_t start = micros();
+	uint16_t elapsed;
+
+	I2C_bus_clear();
+
+	elapsed = micros() - start;
+	i2c_stats.recoveries++;
+	i2c_stats.recovery_us = elapsed;
+	if ( elapsed > i2c_stats.max_recovery_us )
+	{
+		i2c_stats.max_recovery_us = elapsed;
+	}
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function records duration of a finished transaction
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	I2C_count_xfer
+*
+*   Parameters 		:  	uint32_t start_us	-	micros() at START of transaction
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void I2C_count_xfer( uint32_t start_us )
+{
+	uint32_t elapsed = micros() - start_us;
+
+	//Saturated at 16 bits
+	i2c_stats.xfer_us = ( elapsed > 0xFFFF ) ? 0xFFFF : elapsed;
+	if ( i2c_stats.xfer_us > i2c_stats.max_xfer_us )
+	{
+		i2c_stats.max_xfer_us = i2c_stats.xfer_us;
+	}
+
+	return;
+}
+
+/*********************************************************************************************************/
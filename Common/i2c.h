@@ -0,0 +1,254 @@
+#ifndef I2C_H
+#define I2C_H
+
+/*********************************************************************************************************
+											 HEADER FILES
+*********************************************************************************************************/
+
+#ifndef F_CPU
+#define F_CPU	8000000UL	//Setting clock at 8MHz
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/delay.h>
+
+#include "clock.h"			//Timeouts use millis(), transfer times micros()
+
+/*********************************************************************************************************
+								  CONFIGURATION ( overridden with -D at build time )
+*********************************************************************************************************/
+
+/*	Backend is chosen at compile time, i2c_twi.c and i2c_bb.c are both built and only the
+ *	selected one has any code. Every call goes straight to the backend function.			*/
+#define I2C_BACKEND_TWI			1			//TWI peripheral, driven from its interrupt
+#define I2C_BACKEND_BITBANG		2			//GPIO pins, driven by CPU
+
+#ifndef I2C_BACKEND
+#define I2C_BACKEND				I2C_BACKEND_TWI
+#endif
+
+#ifndef I2C_SCL_HZ
+#define I2C_SCL_HZ				I2C_STANDARD_HZ
+#endif
+
+#ifndef I2C_TIMEOUT_MS
+#define I2C_TIMEOUT_MS			10			//Longest transaction, an RTC read takes under 1ms at standard rate
+#endif
+
+#ifndef I2C_RETRIES
+#define I2C_RETRIES				2			//Further attempts before transaction is reported as failed
+#endif
+
+//Bit bang pins, overridden together. TWI always uses PC0 and PC1
+#ifndef I2C_BB_PORT
+#define I2C_BB_PORT				PORTD
+#define I2C_BB_DDR				DDRD
+#define I2C_BB_PIN				PIND
+#define I2C_BB_SCL				PD0
+#define I2C_BB_SDA				PD1
+#endif
+
+/*********************************************************************************************************
+									  	   MACRO DEFINITIONS
+*********************************************************************************************************/
+
+#define PASS					0
+#define FAIL					-1
+
+#define I2C_STANDARD_HZ			100000UL
+#define I2C_FAST_HZ				400000UL
+
+#define I2C_READ				0x01		//Read bit of slave address
+#define I2C_BURST_MAX			16			//Most registers written by one i2c_write_regs call
+#define I2C_RECOVERY_CLOCKS		9			//Enough for slave to shift out rest of a byte and its ACK
+
+//Transaction status
+#define I2C_IDLE				0			//Never submitted
+#define I2C_PENDING				1			//Queued or on bus
+#define I2C_DONE				2
+#define I2C_ERROR				3
+
+#if I2C_BACKEND == I2C_BACKEND_TWI
+
+#define TWI_QUEUE_SIZE			4			//Number of queued transactions, must be a power of two
+#define TWI_QUEUE_MASK			( TWI_QUEUE_SIZE - 1 )
+
+/*	SCL = F_CPU / ( 16 + 2 * TWBR * 4^TWPS ), TWBR and TWPS are worked out by the compiler.
+ *	TWBR is rounded up so SCL never exceeds the requested rate, and the smallest prescaler
+ *	is used for the finest steps. Below TWBR = 10 the master may corrupt SDA and SCL, which
+ *	limits SCL to about F_CPU / 36, so fast mode needs F_CPU of at least 14.4MHz.		*/
+#define TWI_TWBR_MIN			10
+#define TWI_CYCLES(hz)			( ( (F_CPU) + (hz) - 1 ) / (hz) )
+#define TWI_TWBR_FOR(hz, presc)	( ( TWI_CYCLES(hz) - 16 + 2 * (presc) - 1 ) / ( 2 * (presc) ) )
+#define TWI_FITS(hz, presc)		( TWI_TWBR_FOR(hz, presc) <= 255 )
+
+#define TWI_PRESCALER(hz)		( TWI_FITS(hz, 1) ? 1 : TWI_FITS(hz, 4) ? 4 : TWI_FITS(hz, 16) ? 16 : 64 )
+#define TWI_TWPS(hz)			( TWI_FITS(hz, 1) ? 0 : TWI_FITS(hz, 4) ? 1 : TWI_FITS(hz, 16) ? 2 : 3 )
+#define TWI_TWBR(hz)			TWI_TWBR_FOR(hz, TWI_PRESCALER(hz))
+#define TWI_SCL_ACTUAL(hz)		( (F_CPU) / ( 16 + 2 * TWI_TWBR(hz) * TWI_PRESCALER(hz) ) )
+#define TWI_REACHABLE(hz)		( TWI_CYCLES(hz) >= 16 + 2 * TWI_TWBR_MIN && TWI_FITS(hz, 64) )
+
+#if !TWI_REACHABLE(I2C_SCL_HZ)
+#error "I2C_SCL_HZ cannot be generated by TWI from F_CPU"
+#endif
+
+//Bus recovery drives pins as GPIO while TWI is disabled
+#define TWI_PORT				PORTC
+#define TWI_DDR					DDRC
+#define TWI_PIN					PINC
+#define TWI_SCL					PC0
+#define TWI_SDA					PC1
+#define TWI_RECOVERY_HALF_US	( ( 500000UL + TWI_SCL_ACTUAL(I2C_SCL_HZ) - 1 ) / TWI_SCL_ACTUAL(I2C_SCL_HZ) )
+
+#define MASK_5_BITS_FROM_MSB	0xF8
+
+#define START_SUCCESS					0x08
+#define REPEATED_START_SUCCESS			0x10
+
+//Status codes for Master transmitter mode
+#define MT_SLAVE_ADDR_ACK				0x18
+#define MT_SLAVE_ADDR_NACK				0x20
+#define MT_DATA_ACK						0x28
+#define MT_DATA_NACK					0x30
+
+//Status codes for Master receiver mode
+#define MR_SLAVE_ADDR_ACK				0x40
+#define MR_SLAVE_ADDR_NACK				0x48
+#define MR_DATA_RECEIVE_ACK				0x50
+#define MR_DATA_RECEIVE_NACK			0x58
+
+#elif I2C_BACKEND == I2C_BACKEND_BITBANG
+
+#define BIT_ACK					0
+#define BIT_NACK				1
+
+//Lines are open drain, pulled low by making pin an output and released by making it an input
+#define SCL_LOW					I2C_BB_DDR |= (1 << I2C_BB_SCL)
+#define SCL_RELEASE				I2C_BB_DDR &= ~(1 << I2C_BB_SCL)
+#define SDA_LOW					I2C_BB_DDR |= (1 << I2C_BB_SDA)
+#define SDA_RELEASE				I2C_BB_DDR &= ~(1 << I2C_BB_SDA)
+#define SCL_IS_HIGH				( I2C_BB_PIN & (1 << I2C_BB_SCL) )
+#define SDA_IS_HIGH				( I2C_BB_PIN & (1 << I2C_BB_SDA) )
+
+/*	Bit timing is counted in CPU cycles. SCL period is split in a low and a high phase which
+ *	meet the minimum times of the I2C specification, and instructions in each phase are
+ *	subtracted from its delay. Overheads are not measured with a listing or a scope. They are
+ *	the cycles every transmitted and received bit is certain to spend, from AVR instruction
+ *	timings: low phase ends with CBI releasing SCL ( 2 ), high phase has SBIS of the stretch
+ *	check skipping the call ( 2 ) and ends with SBI pulling SCL low ( 2 ). Any further
+ *	instruction only lengthens a phase.
+ *
+ *	Interrupts stay enabled while bits are shifted, so an interrupt in a phase stretches it
+ *	by the length of its handler. Phase times are minimums, not exact periods, which I2C
+ *	allows as the master owns the clock. Bytes are not run with interrupts disabled because
+ *	a slave may stretch the clock for up to I2C_STRETCH_MAX_US.							*/
+#define I2C_NS_CYCLES(ns)		( ( (F_CPU) / 1000UL * (ns) + 999999UL ) / 1000000UL )
+#define I2C_BB_PERIOD			( ( (F_CPU) + I2C_SCL_HZ - 1 ) / I2C_SCL_HZ )
+#define I2C_BB_TLOW_MIN			I2C_NS_CYCLES( ( I2C_SCL_HZ > I2C_STANDARD_HZ ) ? 1300 : 4700 )
+#define I2C_BB_THIGH_MIN		I2C_NS_CYCLES( ( I2C_SCL_HZ > I2C_STANDARD_HZ ) ? 600 : 4000 )
+
+#define I2C_BB_LOW_CYCLES		( ( I2C_BB_PERIOD - I2C_BB_PERIOD / 2 > I2C_BB_TLOW_MIN ) ? \
+								  I2C_BB_PERIOD - I2C_BB_PERIOD / 2 : I2C_BB_TLOW_MIN )
+#define I2C_BB_HIGH_CYCLES		( ( I2C_BB_PERIOD - I2C_BB_LOW_CYCLES > I2C_BB_THIGH_MIN ) ? \
+								  I2C_BB_PERIOD - I2C_BB_LOW_CYCLES : I2C_BB_THIGH_MIN )
+#define I2C_BB_LOW_OVERHEAD		2
+#define I2C_BB_HIGH_OVERHEAD	4
+
+#if I2C_BB_PERIOD < I2C_BB_TLOW_MIN + I2C_BB_THIGH_MIN || \
+	I2C_BB_LOW_CYCLES < I2C_BB_LOW_OVERHEAD || I2C_BB_HIGH_CYCLES < I2C_BB_HIGH_OVERHEAD
+#error "I2C_SCL_HZ is too fast for F_CPU"
+#endif
+
+//Delays left in each phase
+#define I2C_BB_LOW				( I2C_BB_LOW_CYCLES - I2C_BB_LOW_OVERHEAD )
+#define I2C_BB_HIGH				( I2C_BB_HIGH_CYCLES - I2C_BB_HIGH_OVERHEAD )
+#define I2C_DELAY(cycles)		__builtin_avr_delay_cycles( cycles )
+
+//Clock stretching is waited for at most I2C_STRETCH_MAX_US, one spin takes about 6 cycles
+#define I2C_STRETCH_MAX_US		1000
+#define I2C_STRETCH_SPINS		( (F_CPU) / 1000000UL * I2C_STRETCH_MAX_US / 6 )
+
+//SCL is released and, when a slave holds it low, waited for
+#define I2C_SCL_RISE()			do { SCL_RELEASE; if ( !SCL_IS_HIGH ) I2C_wait_scl(); } while (0)
+
+//One bit of a byte, entered and left with SCL low. Data is set in low phase and sampled at end of high phase
+#define I2C_TX_BIT(byte, mask)	do { if ( (byte) & (mask) ) { SDA_RELEASE; } else { SDA_LOW; } \
+									 I2C_DELAY( I2C_BB_LOW ); I2C_SCL_RISE(); I2C_DELAY( I2C_BB_HIGH ); SCL_LOW; } while (0)
+#define I2C_RX_BIT(byte, mask)	do { I2C_DELAY( I2C_BB_LOW ); I2C_SCL_RISE(); I2C_DELAY( I2C_BB_HIGH ); \
+									 if ( SDA_IS_HIGH ) { (byte) |= (mask); } SCL_LOW; } while (0)
+
+#else
+#error "I2C_BACKEND has to be I2C_BACKEND_TWI or I2C_BACKEND_BITBANG"
+#endif
+
+/*******************************************************************************************************
+										 STRUCTURE DEFINITION
+*******************************************************************************************************/
+
+/*	I2C transaction. Write phase sends wlen bytes, read phase then receives rlen bytes after a
+ *	repeated START. Either phase may be empty, but i2c_submit refuses a transaction
+ *	with both empty by returning FAIL. TWI backend carries it out from its interrupt,
+ *	bit bang backend before i2c_submit returns.											*/
+typedef struct I2C_xfer
+{
+	uint8_t addr;							//Slave address with write bit
+	const uint8_t *wbuf;					//Bytes sent in write phase
+	uint8_t wlen;
+	uint8_t *rbuf;							//Bytes received in read phase
+	uint8_t rlen;
+	void (*done)(struct I2C_xfer*);			//Called when transaction ends, from interrupt on TWI, may be NULL
+	volatile int8_t status;					//I2C_IDLE, I2C_PENDING, I2C_DONE or I2C_ERROR
+}I2C_xfer;
+
+//Bus failure counters and transfer times of the selected backend
+typedef struct
+{
+	unsigned int errors;					//Transactions which failed after all retries
+	unsigned int retries;					//Attempts repeated after NACK, bus error or timeout
+	unsigned int timeouts;					//Transactions given up for taking too long
+	unsigned int recoveries;				//Bus clear sequences sent
+	uint16_t recovery_us;					//Duration of last bus clear
+	uint16_t max_recovery_us;				//Longest bus clear
+	uint16_t xfer_us;						//Duration of last transaction, from START to STOP
+	uint16_t max_xfer_us;					//Longest transaction
+}I2C_stats;
+
+extern I2C_stats i2c_stats;
+
+/*******************************************************************************************************
+										  FUNCTION PROTOTYPES
+*******************************************************************************************************/
+
+//Provided by selected backend
+void I2C_init(void);
+int i2c_submit(I2C_xfer*);
+int i2c_busy(void);
+void i2c_watchdog(void);
+void I2C_bus_clear(void);
+
+//Common to both backends
+int i2c_wait(I2C_xfer*);
+int i2c_write_regs(uint8_t, uint8_t, const uint8_t*, uint8_t);
+int i2c_read_regs(uint8_t, uint8_t, uint8_t*, uint8_t);
+void I2C_bus_recover(void);
+void I2C_count_xfer(uint32_t);
+
+#if I2C_BACKEND == I2C_BACKEND_TWI
+void twi_next(void);
+void twi_begin(void);
+void twi_finish(int8_t);
+#else
+void I2C_wait_scl(void);
+void I2C_start(void);
+int I2C_send_byte(uint8_t);
+uint8_t I2C_read_byte(int);
+void I2C_stop(void);
+int I2C_xfer_once(I2C_xfer*);
+#endif
+
+/*********************************************************************************************************/
+
+#endif
@@ -0,0 +1,380 @@
+/*******************************************************************************************************
+											 HEADER FILES
+*******************************************************************************************************/
+
+#include "i2c.h"
+
+#if I2C_BACKEND == I2C_BACKEND_BITBANG
+
+/*******************************************************************************************************
+										    GLOBAL VARIABLES
+*******************************************************************************************************/
+
+uint8_t i2c_bus_fault;					//Set when a slave stretched clock for too long
+
+/*******************************************************************************************************
+										  FUNCTION DEFINITIONS
+*******************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------
+	Function performs I2C initializations
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	I2C_init
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void I2C_init(void)
+{ 
+	//Pins only ever drive low, lines are pulled high by bus pull up resistors
+	I2C_BB_PORT &= ~( (1 << I2C_BB_SCL) | (1 << I2C_BB_SDA) );
+	SCL_RELEASE;
+	SDA_RELEASE;
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function waits while a slave holds SCL low ( clock stretching ), for a bounded time
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	I2C_wait_scl
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void I2C_wait_scl(void)
+{
+	uint16_t spins = I2C_STRETCH_SPINS;
+
+	while ( !SCL_IS_HIGH )
+	{
+		if ( --spins == 0 )
+		{
+			i2c_bus_fault = 1;		//Transaction is failed by caller
+			return;
+		}
+	}
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function generates START, or repeated START when called in the middle of a transaction
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	I2C_start
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void I2C_start(void)
+{
+	i2c_bus_fault = 0;
+
+	//Both lines are released first, which leaves an idle bus as it is
+	SDA_RELEASE;
+	I2C_DELAY( I2C_BB_LOW );
+	I2C_SCL_RISE();
+	I2C_DELAY( I2C_BB_HIGH );
+
+	//SDA falls while SCL is high
+	SDA_LOW;
+	I2C_DELAY( I2C_BB_HIGH );
+	SCL_LOW;
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function reads a byte from SDA and answers it with ACK or NACK
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	I2C_read_byte
+*
+*   Parameters 		:  	int ack		-	BIT_ACK to ask for another byte, BIT_NACK after last byte
+*
+*   Return     		: 	Received byte
+*-------------------------------------------------------------------------------------------------------*/
+
+uint8_t I2C_read_byte( int ack )
+{
+	uint8_t byte = 0x00;
+
+	SDA_RELEASE;					//Slave drives SDA
+
+	//Unrolled so no loop instructions are added to the counted phases
+	I2C_RX_BIT( byte, 0x80 );
+	I2C_RX_BIT( byte, 0x40 );
+	I2C_RX_BIT( byte, 0x20 );
+	I2C_RX_BIT( byte, 0x10 );
+	I2C_RX_BIT( byte, 0x08 );
+	I2C_RX_BIT( byte, 0x04 );
+	I2C_RX_BIT( byte, 0x02 );
+	I2C_RX_BIT( byte, 0x01 );
+
+	I2C_TX_BIT( ack, BIT_NACK );
+
+	return byte;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function sends a byte of data to SDA 
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	I2C_send_byte
+*
+*   Parameters 		:  	uint8_t byte
+*
+*   Return     		: 	ACK or NACK, NACK also when slave stretched clock for too long
+*-------------------------------------------------------------------------------------------------------*/
+
+int I2C_send_byte( uint8_t byte )
+{
+	uint8_t ack_bit = 0;
+
+	//Unrolled so no loop instructions are added to the counted phases
+	I2C_TX_BIT( byte, 0x80 );
+	I2C_TX_BIT( byte, 0x40 );
+	I2C_TX_BIT( byte, 0x20 );
+	I2C_TX_BIT( byte, 0x10 );
+	I2C_TX_BIT( byte, 0x08 );
+	I2C_TX_BIT( byte, 0x04 );
+	I2C_TX_BIT( byte, 0x02 );
+	I2C_TX_BIT( byte, 0x01 );
+
+	//Slave pulls SDA low in ninth clock to acknowledge
+	SDA_RELEASE;
+	I2C_RX_BIT( ack_bit, BIT_NACK );
+
+	if ( i2c_bus_fault )
+	{
+		return BIT_NACK;
+	}
+
+	return ack_bit;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function stops I2C communication
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	I2C_stop
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void I2C_stop(void)
+{
+	//SDA rises while SCL is high
+	SDA_LOW;
+	I2C_DELAY( I2C_BB_LOW );
+	I2C_SCL_RISE();
+	I2C_DELAY( I2C_BB_HIGH );
+	SDA_RELEASE;
+
+	//Bus free time before next START
+	I2C_DELAY( I2C_BB_LOW );
+	
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function clocks SCL until slave releases SDA and sends STOP
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	I2C_bus_clear
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void I2C_bus_clear(void)
+{
+	int clock;
+
+	SDA_RELEASE;
+	SCL_RELEASE;
+	I2C_DELAY( I2C_BB_HIGH );
+
+	//Slave stuck in middle of a byte shifts out rest of it, at most 9 clocks including ACK
+	for (clock = 0; ( clock < I2C_RECOVERY_CLOCKS ) && !SDA_IS_HIGH; clock += 1)
+	{
+		SCL_LOW;
+		I2C_DELAY( I2C_BB_LOW );
+		I2C_SCL_RISE();
+		I2C_DELAY( I2C_BB_HIGH );
+	}
+
+	SCL_LOW;
+	I2C_stop();
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function carries out a transaction once
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	I2C_xfer_once
+*
+*   Parameters 		:  	I2C_xfer *xfer	-	Transaction
+*
+*   Return     		: 	PASS, or FAIL when slave did not acknowledge or stretched clock for too long
+*-------------------------------------------------------------------------------------------------------*/
+
+int I2C_xfer_once( I2C_xfer *xfer )
+{
+	uint8_t itr;
+
+	I2C_start();
+
+	if ( xfer->wlen > 0 )
+	{
+		if ( I2C_send_byte( xfer->addr ) == BIT_NACK )
+		{
+			I2C_stop();
+			return FAIL;
+		}
+
+		for (itr = 0; itr < xfer->wlen; itr += 1)
+		{
+			if ( I2C_send_byte( xfer->wbuf[itr] ) == BIT_NACK )
+			{
+				I2C_stop();
+				return FAIL;
+			}
+		}
+
+		if ( xfer->rlen > 0 )
+		{
+			I2C_start();						//Repeated START
+		}
+	}
+
+	if ( xfer->rlen > 0 )
+	{
+		if ( I2C_send_byte( xfer->addr | I2C_READ ) == BIT_NACK )
+		{
+			I2C_stop();
+			return FAIL;
+		}
+
+		//Every byte but the last is acknowledged
+		for (itr = 0; itr < xfer->rlen; itr += 1)
+		{
+			xfer->rbuf[itr] = I2C_read_byte( ( itr + 1 < xfer->rlen ) ? BIT_ACK : BIT_NACK );
+		}
+	}
+
+	I2C_stop();
+
+	return i2c_bus_fault ? FAIL : PASS;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function carries out a transaction before returning, retrying it a bounded number of times
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	i2c_submit
+*
+*   Parameters 		:  	I2C_xfer *xfer	-	Transaction
+*
+*   Return     		: 	PASS, result of transaction is in its status, or FAIL for an empty transaction
+*-------------------------------------------------------------------------------------------------------*/
+
+int i2c_submit( I2C_xfer *xfer )
+{
+	uint32_t start = millis();
+	uint32_t start_us = micros();
+	int tries;
+
+	//Refused as by TWI backend, status and callback are left untouched
+	if ( ( xfer->wlen == 0 ) && ( xfer->rlen == 0 ) )
+	{
+		return FAIL;
+	}
+
+	xfer->status = I2C_PENDING;
+
+	for (tries = 0; ; tries += 1)
+	{
+		if ( I2C_xfer_once( xfer ) == PASS )
+		{
+			xfer->status = I2C_DONE;
+			break;
+		}
+
+		//Slave which did not answer may be holding SDA
+		I2C_bus_recover();
+
+		if ( ( millis() - start > I2C_TIMEOUT_MS ) || ( tries >= I2C_RETRIES ) )
+		{
+			if ( tries < I2C_RETRIES )
+			{
+				i2c_stats.timeouts++;
+			}
+
+			i2c_stats.errors++;
+			xfer->status = I2C_ERROR;
+			break;
+		}
+
+		i2c_stats.retries++;
+	}
+
+	I2C_count_xfer( start_us );
+
+	if ( xfer->done != NULL )
+	{
+		xfer->done( xfer );
+	}
+
+	return PASS;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function is kept for TWI compatibility, bit bang transactions end before i2c_submit returns
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	i2c_watchdog
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void i2c_watchdog(void)
+{
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function returns 1 while a transaction is on the bus, which is never seen outside i2c_submit
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	i2c_busy
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	0
+*-------------------------------------------------------------------------------------------------------*/
+
+int i2c_busy(void)
+{
+	return 0;
+}
+
+#endif
+
+/*******************************************************************************************************/
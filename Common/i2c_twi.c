@@ -0,0 +1,340 @@
+/*******************************************************************************************************
+											 HEADER FILES										
+*******************************************************************************************************/
+
+#include "i2c.h"
+
+#if I2C_BACKEND == I2C_BACKEND_TWI
+
+/*******************************************************************************************************
+									   GLOBAL VARIABLES AND ISRs									
+*******************************************************************************************************/
+
+I2C_xfer *twi_queue[TWI_QUEUE_SIZE];		//Transactions waiting for bus
+volatile unsigned char twi_queue_head;		//Next transaction to be started
+volatile unsigned char twi_queue_tail;		//Next free entry
+I2C_xfer * volatile twi_active;				//Transaction on bus, NULL when bus is idle
+uint8_t twi_index;							//Bytes of active phase already transferred
+uint8_t twi_tries;							//Retries of active transaction
+uint32_t twi_started;						//millis() at START of active transaction, for watchdog
+uint32_t twi_started_us;					//micros() at START of active transaction, for statistics
+
+/*	Every TWI status is handled in one interrupt, CPU is free while a byte is on the bus.
+ *	Write phase sends register address or data, read phase follows after repeated START	*/
+ISR( TWI_vect )
+{
+	I2C_xfer *xfer = twi_active;
+	uint8_t ack;
+
+	switch ( TWSR & MASK_5_BITS_FROM_MSB )
+	{
+		case START_SUCCESS			:
+		case REPEATED_START_SUCCESS	:	//Slave address with read bit once write phase is over
+										if ( twi_index < xfer->wlen )
+										{
+											TWDR = xfer->addr;
+										}
+										else
+										{
+											TWDR = xfer->addr | I2C_READ;
+											twi_index = 0;
+										}
+										TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE);
+										break;
+
+		case MT_SLAVE_ADDR_ACK		:
+		case MT_DATA_ACK			:	if ( twi_index < xfer->wlen )
+										{
+											TWDR = xfer->wbuf[twi_index++];
+											TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE);
+										}
+										else if ( xfer->rlen > 0 )
+										{
+											TWCR = (1 << TWINT) | (1 << TWSTA) | (1 << TWEN) | (1 << TWIE);
+										}
+										else
+										{
+											twi_finish( I2C_DONE );
+										}
+										break;
+
+		case MR_DATA_RECEIVE_ACK	:	xfer->rbuf[twi_index++] = TWDR;
+										//fall through
+		case MR_SLAVE_ADDR_ACK		:	//Last byte is answered with NACK
+										ack = ( twi_index + 1 < xfer->rlen ) ? (1 << TWEA) : 0;
+										TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE) | ack;
+										break;
+
+		case MR_DATA_RECEIVE_NACK	:	xfer->rbuf[twi_index++] = TWDR;
+										twi_finish( I2C_DONE );
+										break;
+
+		default						:	//NACK from slave or arbitration lost
+										twi_finish( I2C_ERROR );
+										break;
+	}
+}
+
+/*******************************************************************************************************
+										  FUNCTION DEFINITIONS 					
+*******************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------
+	Function sets SCL rate to I2C_SCL_HZ
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	I2C_init
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void I2C_init(void)
+{ 
+	//Bit rate and prescaler for I2C_SCL_HZ are computed in i2c.h
+	TWSR = TWI_TWPS(I2C_SCL_HZ);
+	TWBR = TWI_TWBR(I2C_SCL_HZ);
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function queues a transaction, which is carried out by TWI interrupt
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	i2c_submit
+*
+*   Parameters 		:  	I2C_xfer *xfer	-	Transaction, its buffers have to stay valid until it completes
+*
+*   Return     		: 	PASS or FAIL when queue is full, transaction is already queued or empty
+*-------------------------------------------------------------------------------------------------------*/
+
+int i2c_submit( I2C_xfer *xfer )
+{
+	unsigned char next;
+	uint8_t sreg;
+
+	//Empty transaction would fall through to a read into rbuf
+	if ( ( xfer->status == I2C_PENDING ) || ( ( xfer->wlen == 0 ) && ( xfer->rlen == 0 ) ) )
+	{
+		return FAIL;
+	}
+
+	sreg = SREG;
+	cli();
+
+	next = ( twi_queue_tail + 1 ) & TWI_QUEUE_MASK;
+	if ( next == twi_queue_head )
+	{
+		SREG = sreg;
+		return FAIL;
+	}
+
+	xfer->status = I2C_PENDING;
+	twi_queue[twi_queue_tail] = xfer;
+	twi_queue_tail = next;
+
+	//Bus is idle, starting transaction here, later ones are started by interrupt
+	if ( twi_active == NULL )
+	{
+		twi_begin();
+	}
+
+	SREG = sreg;
+
+	return PASS;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function makes next queued transaction the active one
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	twi_next
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void twi_next(void)
+{
+	twi_active = twi_queue[twi_queue_head];
+	twi_queue_head = ( twi_queue_head + 1 ) & TWI_QUEUE_MASK;
+	twi_index = 0;
+	twi_tries = 0;
+	twi_started = millis();
+	twi_started_us = micros();
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function takes next transaction from queue and generates its START condition
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	twi_begin
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void twi_begin(void)
+{
+	twi_next();
+
+	TWCR = (1 << TWINT) | (1 << TWSTA) | (1 << TWEN) | (1 << TWIE);
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function ends active transaction with STOP, failed transactions are retried a bounded number of times
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	twi_finish
+*
+*   Parameters 		:  	int8_t status	-	I2C_DONE or I2C_ERROR
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void twi_finish( int8_t status )
+{
+	I2C_xfer *xfer = twi_active;
+
+	if ( ( status == I2C_ERROR ) && ( twi_tries < I2C_RETRIES ) )
+	{
+		//STOP is followed by START of same transaction
+		twi_tries += 1;
+		twi_index = 0;
+		twi_started = millis();
+		i2c_stats.retries++;
+
+		TWCR = (1 << TWINT) | (1 << TWSTO) | (1 << TWSTA) | (1 << TWEN) | (1 << TWIE);
+		return;
+	}
+
+	if ( status == I2C_ERROR )
+	{
+		i2c_stats.errors++;
+	}
+
+	I2C_count_xfer( twi_started_us );
+
+	xfer->status = status;
+	twi_active = NULL;
+
+	if ( twi_queue_head != twi_queue_tail )
+	{
+		//STOP is followed by START of next transaction
+		twi_next();
+		TWCR = (1 << TWINT) | (1 << TWSTO) | (1 << TWSTA) | (1 << TWEN) | (1 << TWIE);
+	}
+	else
+	{
+		TWCR = (1 << TWINT) | (1 << TWSTO) | (1 << TWEN);
+	}
+
+	if ( xfer->done != NULL )
+	{
+		xfer->done( xfer );
+	}
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function aborts a transaction which did not end in time and frees the bus
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	i2c_watchdog
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void i2c_watchdog(void)
+{
+	uint8_t sreg = SREG;
+
+	cli();			//Keeping TWI interrupt out while bus is taken over
+
+	if ( ( twi_active != NULL ) && ( millis() - twi_started > I2C_TIMEOUT_MS ) )
+	{
+		i2c_stats.timeouts++;
+
+		I2C_bus_recover();
+		twi_finish( I2C_ERROR );
+	}
+
+	SREG = sreg;
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function clocks SCL until slave releases SDA and sends STOP, with TWI disabled
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	I2C_bus_clear
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void I2C_bus_clear(void)
+{
+	int clock;
+
+	//Lines are driven as open drain GPIO, low through DDR and released through pull up
+	TWCR = 0x00;
+	TWI_PORT &= ~( (1 << TWI_SCL) | (1 << TWI_SDA) );
+	TWI_DDR &= ~( (1 << TWI_SCL) | (1 << TWI_SDA) );
+	_delay_us( TWI_RECOVERY_HALF_US );
+
+	//Slave stuck in middle of a byte shifts out rest of it, at most 9 clocks including ACK
+	for (clock = 0; ( clock < I2C_RECOVERY_CLOCKS ) && ( ( TWI_PIN & (1 << TWI_SDA) ) == 0 ); clock += 1)
+	{
+		TWI_DDR |= (1 << TWI_SCL);
+		_delay_us( TWI_RECOVERY_HALF_US );
+		TWI_DDR &= ~(1 << TWI_SCL);
+		_delay_us( TWI_RECOVERY_HALF_US );
+	}
+
+	//STOP condition, SDA rises while SCL is high
+	TWI_DDR |= (1 << TWI_SCL);
+	_delay_us( TWI_RECOVERY_HALF_US );
+	TWI_DDR |= (1 << TWI_SDA);
+	_delay_us( TWI_RECOVERY_HALF_US );
+	TWI_DDR &= ~(1 << TWI_SCL);
+	_delay_us( TWI_RECOVERY_HALF_US );
+	TWI_DDR &= ~(1 << TWI_SDA);
+
+	TWCR = (1 << TWEN);
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function returns 1 while transactions are queued or on the bus
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	i2c_busy
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	1 or 0
+*-------------------------------------------------------------------------------------------------------*/
+
+int i2c_busy(void)
+{
+	return ( twi_active != NULL );
+}
+
+#endif
+
+/*******************************************************************************************************/
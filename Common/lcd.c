@@ -0,0 +1,743 @@
+/*******************************************************************************************************
+											 HEADER FILES
+*******************************************************************************************************/
+
+#include "lcd.h"
+
+/*******************************************************************************************************
+									   GLOBAL VARIABLES AND ISRs
+*******************************************************************************************************/
+
+//DDRAM address of first character in each line
+const unsigned char lcd_row_base[4] = { LCD_ROW_BASE(0), LCD_ROW_BASE(1), LCD_ROW_BASE(2), LCD_ROW_BASE(3) };
+
+unsigned char lcd_cursor_row = 0;			//Line of LCD address counter, counted from 0
+unsigned char lcd_cursor_col = 0;			//Column of LCD address counter
+
+#if LCD_USE_WRITE_QUEUE
+LCD_entry lcd_queue[LCD_QUEUE_SIZE];				//Commands and data waiting to be sent to LCD
+volatile unsigned char lcd_queue_head = 0;			//Next entry to be sent, advanced only by timer interrupt
+volatile unsigned char lcd_queue_tail = 0;			//Next free entry, advanced only by writers
+volatile unsigned char lcd_queue_holdoff = 0;		//Ticks left for slow instruction when busy flag is not used
+unsigned char lcd_queue_peak = 0;					//High water mark of queue
+unsigned int lcd_queue_overflow = 0;				//Number of writes which found the queue full
+
+ISR( TIMER0_COMP_vect )
+{
+	lcd_queue_service();
+}
+#endif
+
+/*******************************************************************************************************
+										  FUNCTION DEFINITIONS
+*******************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------
+	Function performs LCD initilizations
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_init
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_init(void)
+{
+#if LCD_USE_WRITE_QUEUE
+	//Timer0 in CTC mode sends one queued entry to LCD on every compare match
+	OCR0 = LCD_QUEUE_TIMER_COUNT;
+	TCCR0 = LCD_QUEUE_TIMER_CTC | LCD_QUEUE_TIMER_PRESCALAR;
+#endif
+
+	LCD_CTRL_DDR |= LCD_CTRL_ENABLE;		//RS, RW, and EN set as output
+	LCD_DATA_DDR |= LCD_DATA_MASK;			//Configuring data lines as output
+
+	//Instructions are ignored and busy flag is not valid during power on reset, waited for in every mode
+	_delay_ms(40);
+
+#if LCD_BUS_WIDTH == 4
+	/*	After power on LCD is in 8 bit mode and only DATA4 - DATA7 are connected,
+	 *	so function set is sent as single nibbles with fixed delays until the
+	 *	LCD switches to 4 bit interface. Busy flag can not be read before that.	*/
+
+	LCD_CTRL_PORT &= ~(1 << RS);		//Command mode
+	LCD_CTRL_PORT &= ~(1 << RW);		//Write mode
+
+	lcd_latch( LCD_INIT_NIBBLE );
+	_delay_ms(5);
+	lcd_latch( LCD_INIT_NIBBLE );
+	_delay_us(100);
+	lcd_latch( LCD_INIT_NIBBLE );
+	_delay_us(100);
+	lcd_latch( LCD_FOUR_BIT_NIBBLE );
+	_delay_us(100);
+#endif
+
+	lcd_command( LCD_FUNCTION_SET );
+	lcd_command( CLR_SCR );
+	lcd_command( RET_HOME );
+	lcd_command( MOVE_TO_BEG_LINE1 );
+	lcd_command( DISP_ON_CURSOR_OFF );
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function reads busy flag of LCD
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_read_busy
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	Non zero value if LCD is busy
+*-------------------------------------------------------------------------------------------------------*/
+
+unsigned char lcd_read_busy(void)
+{
+	unsigned char status;
+
+	LCD_DATA_DDR &= (unsigned char)~LCD_DATA_MASK;		//Configuring data lines as input for reading busy flag
+	LCD_DATA_PORT &= (unsigned char)~LCD_DATA_MASK;	//Disabling pull ups, LCD drives the data lines
+
+	LCD_CTRL_PORT &= ~(1 << RS);		//Command mode
+	LCD_CTRL_PORT |= (1 << RW);			//Read mode
+	LCD_CTRL_PORT |= (1 << EN);			//Enable high
+
+	_delay_us(1);				//Waiting for data to be valid on data lines
+	status = LCD_DATA_PIN;
+
+	LCD_CTRL_PORT &= ~(1 << EN);		//Enable low
+
+#if LCD_BUS_WIDTH == 4
+	//Low nibble of address counter has to be clocked out to complete the read
+	_delay_us(1);
+	LCD_CTRL_PORT |= (1 << EN);
+	_delay_us(1);
+	LCD_CTRL_PORT &= ~(1 << EN);
+#endif
+
+	LCD_CTRL_PORT &= ~(1 << RW);		//Write mode
+	LCD_DATA_DDR |= LCD_DATA_MASK;		//Configuring data lines back as output
+
+	return ( status & (1 << BUSY_FLAG) );
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function waits until LCD has finished executing previous instruction
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_wait_busy
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_wait_busy(void)
+{
+#if LCD_USE_BUSY_FLAG
+	while ( lcd_read_busy() );
+#endif
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function latches a byte into command or data register of LCD
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_write
+*
+*   Parameters 		:  	unsigned char byte	-	Command or data
+*						unsigned char mode	-	LCD_COMMAND_MODE or LCD_DATA_MODE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_write( unsigned char byte, unsigned char mode )
+{
+	if ( mode == LCD_DATA_MODE )
+	{
+		LCD_CTRL_PORT |= (1 << RS);		//Data mode
+	}
+	else
+	{
+		LCD_CTRL_PORT &= ~(1 << RS);	//Command mode
+	}
+
+	LCD_CTRL_PORT &= ~(1 << RW);		//Write mode
+
+#if LCD_BUS_WIDTH == 4
+	lcd_latch( byte >> 4 );		//Higher nibble is sent first
+	lcd_latch( byte & 0x0F );
+#else
+	lcd_latch( byte );
+#endif
+
+#if !LCD_USE_BUSY_FLAG && !LCD_USE_WRITE_QUEUE
+	//Without busy flag LCD is given its worst case execution time before the next write
+	if ( ( mode == LCD_COMMAND_MODE ) && ( ( byte & LCD_SLOW_CMD_MASK ) == 0 ) )
+	{
+		_delay_us( LCD_SLOW_EXEC_TIME_US );
+	}
+	else
+	{
+		_delay_us( LCD_EXEC_TIME_US );
+	}
+#endif
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function places bits on data lines and pulses enable so LCD latches them
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_latch
+*
+*   Parameters 		:  	unsigned char bits	-	Byte in 8 bit mode or nibble in 4 bit mode
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_latch( unsigned char bits )
+{
+#if LCD_BUS_WIDTH == 4
+	//Only DATA4 - DATA7 pins are changed, other pins of the port are left untouched
+	LCD_DATA_PORT = ( LCD_DATA_PORT & ~LCD_DATA_MASK ) | ( ( bits << LCD_DATA_SHIFT ) & LCD_DATA_MASK );
+#else
+	LCD_DATA_PORT = bits;
+#endif
+
+	LCD_CTRL_PORT |= (1 << EN);			//Enable high
+	_delay_us(1);						//Enable pulse width
+	LCD_CTRL_PORT &= ~(1 << EN);		//Enable low, LCD latches the bits
+	_delay_us(1);						//Enable cycle time
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function send command from user to LCD
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_command
+*
+*   Parameters 		:  	unsigned char cmd
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_command( unsigned char cmd )
+{
+	//Clear screen and return home move cursor to start of line 1
+	if ( ( cmd & LCD_SLOW_CMD_MASK ) == 0 )
+	{
+		lcd_cursor_row = 0;
+		lcd_cursor_col = LINE_START;
+	}
+
+#if LCD_USE_WRITE_QUEUE
+	lcd_queue_put( cmd, LCD_COMMAND_MODE );
+#else
+	lcd_wait_busy();			//Waiting until previous instruction is executed
+	lcd_write( cmd, LCD_COMMAND_MODE );
+#endif
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function send data from user to LCD
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_data
+*
+*   Parameters 		:  	unsigned char data
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_data( unsigned char data )
+{
+#if LCD_USE_WRITE_QUEUE
+	lcd_queue_put( data, LCD_DATA_MODE );
+#else
+	lcd_wait_busy();			//Waiting until previous instruction is executed
+	lcd_write( data, LCD_DATA_MODE );
+#endif
+	lcd_cursor_col += 1;		//Following LCD address counter
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function streams characters to LCD from the current cursor position
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_stream
+*
+*   Parameters 		:  	const char *str			-	String of characters
+*						int size				-	Number of characters, LCD_STREAM_NUL to stop at NUL
+*						unsigned char memory	-	LCD_STREAM_RAM or LCD_STREAM_PGM
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_stream( const char *str, int size, unsigned char memory )
+{
+	unsigned char room, row, data;
+
+	/*	LCD auto increments its address counter, so characters of a row are sent
+	 *	back to back and an address command is needed only when a row is full	*/
+	room = ( lcd_cursor_col < LINE_END ) ? ( LINE_END - lcd_cursor_col ) : 0;
+
+	while (1)
+	{
+		data = ( memory == LCD_STREAM_PGM ) ? pgm_read_byte( str ) : *str;
+
+		if ( ( size == 0 ) || ( ( size == LCD_STREAM_NUL ) && ( data == '\0' ) ) )
+		{
+			return;
+		}
+
+		if ( room == 0 )
+		{
+			row = lcd_cursor_row + 1;
+			lcd_set_cursor( LINE_START, ( row < LCD_LINES ) ? ( row + LINE1 ) : LINE1 );
+			room = LINE_END;
+		}
+
+		lcd_data( data );
+		str += 1;
+		room -= 1;
+
+		if ( size > 0 )
+		{
+			size -= 1;
+		}
+	}
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function send string of data from user to LCD
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_printf
+*
+*   Parameters 		:  	const char *str	-	String of characters
+*						int pos			-	printing start position
+*						int size		- 	Size of string
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_printf( const char *str, int pos, int size )
+{
+	if ( size > pos )
+	{
+		lcd_stream( str + pos, size - pos, LCD_STREAM_RAM );
+	}
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function send length bounded string of data from user to LCD
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_write_n
+*
+*   Parameters 		:  	const char *str	-	String of characters, need not be NUL terminated
+*						int size		-	Number of characters
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_write_n( const char *str, int size )
+{
+	if ( size > 0 )
+	{
+		lcd_stream( str, size, LCD_STREAM_RAM );
+	}
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function send NUL terminated string of data from user to LCD
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_puts
+*
+*   Parameters 		:  	const char *str	-	String of characters
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_puts( const char *str )
+{
+	lcd_stream( str, LCD_STREAM_NUL, LCD_STREAM_RAM );
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function send NUL terminated string stored in program memory to LCD
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_puts_P
+*
+*   Parameters 		:  	const char *str	-	String of characters ( in PROGMEM )
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_puts_P( const char *str )
+{
+	lcd_stream( str, LCD_STREAM_NUL, LCD_STREAM_PGM );
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function stores data in CGRAM addresses
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_create_char
+*
+*   Parameters 		:  	int addr					-	Address of CGRAM
+*						const unsigned char *data	-	Data to be stored
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_create_char( int addr, const unsigned char *data )
+{
+	int char_num, pos, line;
+
+	lcd_get_cursor( &pos, &line );
+
+	//Setting CGRAM address
+	lcd_command( CGRAM_ADDR + addr * LCD_GLYPH_SIZE );
+
+	//Storing data in current CGRAM address
+	for (char_num = 0; char_num < LCD_GLYPH_SIZE; char_num += 1)
+	{
+		lcd_data( *( data + char_num ) );
+	}
+
+	//Address counter is moved back to DDRAM, CGRAM data does not move the cursor
+	lcd_restore_cursor( pos, line );
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function stores data from program memory in CGRAM addresses
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_create_char_P
+*
+*   Parameters 		:  	int addr					-	Address of CGRAM
+*						const unsigned char *data	-	Data to be stored ( in PROGMEM )
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_create_char_P( int addr, const unsigned char *data )
+{
+	int char_num, pos, line;
+
+	lcd_get_cursor( &pos, &line );
+
+	//Setting CGRAM address
+	lcd_command( CGRAM_ADDR + addr * LCD_GLYPH_SIZE );
+
+	//Storing data in current CGRAM address
+	for (char_num = 0; char_num < LCD_GLYPH_SIZE; char_num += 1)
+	{
+		lcd_data( pgm_read_byte( data + char_num ) );
+	}
+
+	//Address counter is moved back to DDRAM, CGRAM data does not move the cursor
+	lcd_restore_cursor( pos, line );
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function sets cursor of lcd at given position in display
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_set_cursor
+*
+*   Parameters 		:  	int pos		-	Position of cursor
+*						int line	-	Line in which cursor should be present
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_set_cursor( int pos, int line )
+{
+	if ( ( line < LINE1 ) || ( line > LCD_LINES ) )
+	{
+		line = LINE1;
+	}
+
+	pos = pos % LINE_END;		//Wrapping position within the line
+
+	//Cursor is placed by writing its DDRAM address in a single command
+	lcd_command( DDRAM_ADDR | ( lcd_row_base[line - LINE1] + pos ) );
+
+	lcd_cursor_row = line - LINE1;
+	lcd_cursor_col = pos;
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function returns position of cursor followed by LCD address counter
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_get_cursor
+*
+*   Parameters 		:  	int *pos	-	Position of cursor, LINE_END after a full line
+*						int *line	-	Line of cursor
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_get_cursor( int *pos, int *line )
+{
+	*pos = lcd_cursor_col;
+	*line = lcd_cursor_row + LINE1;
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function moves cursor back to position returned by lcd_get_cursor, after writes elsewhere in LCD
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_restore_cursor
+*
+*   Parameters 		:  	int pos		-	Position of cursor, not wrapped so a full line stays full
+*						int line	-	Line of cursor
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_restore_cursor( int pos, int line )
+{
+	lcd_command( DDRAM_ADDR | ( lcd_row_base[line - LINE1] + pos ) );
+
+	lcd_cursor_row = line - LINE1;
+	lcd_cursor_col = pos;
+
+	return;
+}
+
+#if LCD_USE_WRITE_QUEUE
+/*--------------------------------------------------------------------------------------------------------
+	Function adds a command or data byte to LCD write queue
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_queue_put
+*
+*   Parameters 		:  	unsigned char byte	-	Command or data
+*						unsigned char mode	-	LCD_COMMAND_MODE or LCD_DATA_MODE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_queue_put( unsigned char byte, unsigned char mode )
+{
+	unsigned char next, depth;
+
+	next = ( lcd_queue_tail + 1 ) & LCD_QUEUE_MASK;
+
+	if ( next == lcd_queue_head )
+	{
+		lcd_queue_overflow++;
+
+		//Waiting for timer interrupt to free an entry, queue is drained here if interrupts are disabled
+		while ( next == lcd_queue_head )
+		{
+			if ( ( SREG & (1 << SREG_I) ) == 0 )
+			{
+				lcd_queue_service();
+			}
+		}
+	}
+
+	lcd_queue[lcd_queue_tail].byte = byte;
+	lcd_queue[lcd_queue_tail].mode = mode;
+	lcd_queue_tail = next;
+
+	depth = ( lcd_queue_tail - lcd_queue_head ) & LCD_QUEUE_MASK;
+	if ( depth > lcd_queue_peak )
+	{
+		lcd_queue_peak = depth;
+	}
+
+	TIMSK |= (1 << OCIE0);		//Enabling timer interrupt which drains the queue
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function sends one entry of LCD write queue to LCD if LCD is ready
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_queue_service
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_queue_service(void)
+{
+	unsigned char port, dir, shared;
+	LCD_entry entry;
+
+	if ( lcd_queue_head == lcd_queue_tail )
+	{
+		TIMSK &= ~(1 << OCIE0);		//Nothing to send, stopping timer interrupt
+		return;
+	}
+
+#if !LCD_USE_BUSY_FLAG
+	//Data lines are not touched while waiting for a slow instruction
+	if ( lcd_queue_holdoff > 0 )
+	{
+		lcd_queue_holdoff--;
+		return;
+	}
+#endif
+
+	//Data lines are shared with other peripherals, so their state is restored after the write
+	LCD_BUS_ACQUIRE(shared);
+	port = LCD_DATA_PORT;
+	dir = LCD_DATA_DDR;
+
+#if LCD_USE_BUSY_FLAG
+	if ( lcd_read_busy() )
+	{
+		LCD_DATA_DDR = dir;
+		LCD_DATA_PORT = port;
+		LCD_BUS_RELEASE(shared);
+		return;						//LCD is still executing previous instruction, retrying in next tick
+	}
+#endif
+
+	entry = lcd_queue[lcd_queue_head];
+	lcd_write( entry.byte, entry.mode );
+	lcd_queue_head = ( lcd_queue_head + 1 ) & LCD_QUEUE_MASK;
+
+	LCD_DATA_DDR = dir;
+	LCD_DATA_PORT = port;
+	LCD_BUS_RELEASE(shared);
+
+#if !LCD_USE_BUSY_FLAG
+	//Clear screen and return home take 1.52ms, all other instructions finish within one tick
+	if ( ( entry.mode == LCD_COMMAND_MODE ) && ( ( entry.byte & LCD_SLOW_CMD_MASK ) == 0 ) )
+	{
+		lcd_queue_holdoff = LCD_SLOW_CMD_TICKS;
+	}
+#endif
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function returns number of entries waiting in LCD write queue
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_queue_depth
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	Number of entries
+*-------------------------------------------------------------------------------------------------------*/
+
+unsigned char lcd_queue_depth(void)
+{
+	return ( ( lcd_queue_tail - lcd_queue_head ) & LCD_QUEUE_MASK );
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function returns maximum number of entries that were waiting in LCD write queue
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_queue_high_water
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	High water mark of queue
+*-------------------------------------------------------------------------------------------------------*/
+
+unsigned char lcd_queue_high_water(void)
+{
+	return lcd_queue_peak;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function returns number of writes which found LCD write queue full
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_queue_overflows
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	Overflow count
+*-------------------------------------------------------------------------------------------------------*/
+
+unsigned int lcd_queue_overflows(void)
+{
+	return lcd_queue_overflow;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function waits until all entries of LCD write queue are sent to LCD, queue is drained here if
+	interrupts are disabled
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_queue_wait
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_queue_wait(void)
+{
+	while ( lcd_queue_head != lcd_queue_tail )
+	{
+		if ( ( SREG & (1 << SREG_I) ) == 0 )
+		{
+			lcd_queue_service();
+		}
+	}
+	return;
+}
+
+#else
+/*--------------------------------------------------------------------------------------------------------
+	Function waits until all entries of LCD write queue are sent to LCD, writes are never queued here
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_queue_wait
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_queue_wait(void)
+{
+	return;
+}
+
+#endif
+
+/*********************************************************************************************************/
@@ -0,0 +1,262 @@
+#ifndef LCD_H
+#define LCD_H
+
+/*********************************************************************************************************
+											 HEADER FILES
+*********************************************************************************************************/
+
+#include "lcd_config.h"		//Pins, geometry and timing strategy of the project using this library
+
+#ifndef F_CPU
+#define F_CPU	8000000UL	//Setting clock at 8MHz
+#endif
+
+#include <stdlib.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include <util/delay.h>
+
+#include "timer.h"
+
+/*********************************************************************************************************
+								  CONFIGURATION ( overridden in lcd_config.h )
+*********************************************************************************************************/
+
+//Control pins
+#ifndef LCD_CTRL_PORT
+#define LCD_CTRL_PORT		PORTD
+#define LCD_CTRL_DDR		DDRD
+#endif
+
+#ifndef RS
+#define RS		PD4
+#define RW		PD5
+#define EN		PD6
+#endif
+
+//Data bus width, 8 bit mode uses DATA0 - DATA7 and 4 bit mode uses DATA4 - DATA7 only
+#ifndef LCD_BUS_WIDTH
+#define LCD_BUS_WIDTH		8
+#endif
+
+//Data pins, in 4 bit mode DATA4 - DATA7 are connected to consecutive pins starting from LCD_DATA_SHIFT
+#ifndef LCD_DATA_PORT
+#define LCD_DATA_PORT		PORTB
+#define LCD_DATA_DDR		DDRB
+#define LCD_DATA_PIN		PINB
+#endif
+
+#ifndef LCD_DATA_SHIFT
+#define LCD_DATA_SHIFT		4
+#endif
+
+//Display geometry
+#ifndef LCD_COLUMNS
+#define LCD_COLUMNS			16
+#endif
+
+#ifndef LCD_LINES
+#define LCD_LINES			2
+#endif
+
+//Set LCD_USE_BUSY_FLAG to 0 for boards where RW pin is tied to ground
+#ifndef LCD_USE_BUSY_FLAG
+#define LCD_USE_BUSY_FLAG	1
+#endif
+
+//Set LCD_USE_WRITE_QUEUE to 1 for sending writes to LCD from Timer0 interrupt
+#ifndef LCD_USE_WRITE_QUEUE
+#define LCD_USE_WRITE_QUEUE	0
+#endif
+
+//Fixed execution times used when busy flag is not read
+#ifndef LCD_EXEC_TIME_US
+#define LCD_EXEC_TIME_US		50				//Most instructions take 37us
+#define LCD_SLOW_EXEC_TIME_US	1600			//Clear screen and return home take 1.52ms
+#endif
+
+/*	Run by LCD queue interrupt around each use of data lines, for other peripherals driven from the same
+ *	pins. ACQUIRE stores what RELEASE needs in state, an unsigned char.						*/
+#ifndef LCD_BUS_ACQUIRE
+#define LCD_BUS_ACQUIRE(state)	do { state = 0; } while (0)
+#define LCD_BUS_RELEASE(state)	do { (void)state; } while (0)
+#endif
+
+#ifndef LCD_QUEUE_SIZE
+#define LCD_QUEUE_SIZE		64					//Number of entries, must be a power of two
+#endif
+
+/*********************************************************************************************************
+									  	   MACRO DEFINITIONS
+*********************************************************************************************************/
+
+#if ( LCD_BUS_WIDTH != 4 ) && ( LCD_BUS_WIDTH != 8 )
+#error "LCD_BUS_WIDTH must be 4 or 8"
+#endif
+
+#if ( LCD_LINES < 1 ) || ( LCD_LINES > 4 )
+#error "LCD_LINES must be between 1 and 4"
+#endif
+
+#if LCD_BUS_WIDTH == 4
+#define LCD_DATA_MASK		( 0x0F << LCD_DATA_SHIFT )
+#define BUSY_FLAG			( LCD_DATA_SHIFT + 3 )		//DATA7 pin
+#else
+#define LCD_DATA_MASK		0xFF
+#define BUSY_FLAG			7							//DATA7 pin
+#endif
+
+//LCD register select
+#define LCD_COMMAND_MODE	0
+#define LCD_DATA_MODE		1
+
+//LCD Commands
+#define CLR_SCR						0x01
+#define RET_HOME					0x02
+#define CURSOR_DECREMENT			0x04
+#define CURSOR_INCREMENT			0x06
+#define CURSOR_DISP_OFF				0x08
+#define CURSOR_SHIFT_LEFT			0x10
+#define CURSOR_SHIFT_RIGHT			0x14
+#define DISP_SHIFT_RIGHT			0x05
+#define DISP_SHIFT_LEFT				0x07
+#define DISP_ON_CURSOR_OFF			0x0C
+#define DISP_ON_CURSOR_ON			0x0E
+#define DISP_ON_CURSOR_BLINK		0x0F
+#define DISP_OFF_CURSOR_ON			0x0A
+#define MOVE_TO_BEG_LINE1			0x80
+#define MOVE_TO_BEG_LINE2			0xC0
+#define DISP_ONE_LINE_EIGHT_BIT		0x30
+#define DISP_ONE_LINE_FOUR_BIT		0x20
+#define SHIFT_ALL_LEFT				0x18
+#define SHIFT_ALL_RIGHT				0x1C
+#define EIGHT_BIT_MODE				0x38
+#define FOUR_BIT_MODE				0x28
+
+#define CGRAM_ADDR					0x40
+#define DDRAM_ADDR					0x80
+
+#define LCD_SLOW_CMD_MASK			0xFC			//Clear screen and return home have none of these bits set
+
+//LCD specific macros
+#define LCD_CAPACITY		( LCD_COLUMNS * LCD_LINES )
+
+#define LINE1				1
+#define LINE2				2
+#define LINE_END			LCD_COLUMNS
+#define LINE_START			0
+
+/*	DDRAM address of first character in each line ( row counted from 0 )
+ *	Odd rows start at 0x40, rows 2 and 3 of four line displays continue
+ *	right after the visible columns of rows 0 and 1							*/
+#define LCD_ROW_BASE(row)	( ( ( row ) & 0x01 ) * 0x40 + ( ( row ) >> 1 ) * LCD_COLUMNS )
+
+#define DDRAM_LINE_SIZE		( ( LCD_LINES == 1 ) ? 80 : 40 )	//Characters stored in DDRAM for each line
+
+#define LCD_CTRL_ENABLE			( ( 1 << RS ) | ( 1 << RW ) | ( 1 << EN ) )
+
+#define LCD_BLANK			' '
+
+//Nibbles written while synchronising LCD to 4 bit interface after power on
+#define LCD_INIT_NIBBLE				( EIGHT_BIT_MODE >> 4 )
+#define LCD_FOUR_BIT_NIBBLE			( FOUR_BIT_MODE >> 4 )
+
+//Function set sent after power on, single line displays have N bit cleared
+#define LCD_TWO_LINE_BIT			0x08
+
+#if LCD_BUS_WIDTH == 4
+#define LCD_FUNCTION_SET			( ( LCD_LINES == 1 ) ? ( FOUR_BIT_MODE & ~LCD_TWO_LINE_BIT ) : FOUR_BIT_MODE )
+#else
+#define LCD_FUNCTION_SET			( ( LCD_LINES == 1 ) ? ( EIGHT_BIT_MODE & ~LCD_TWO_LINE_BIT ) : EIGHT_BIT_MODE )
+#endif
+
+//LCD write queue macros
+#define LCD_QUEUE_MASK				( LCD_QUEUE_SIZE - 1 )
+#define LCD_QUEUE_TICK_US			50				//One entry is sent every tick
+#define LCD_QUEUE_TIMER_CTC			( 1 << WGM01 )
+#define LCD_QUEUE_TIMER_PRESCALAR	TIMER0_CS(LCD_QUEUE_TICK_US)	//Prescaler 8 at 8MHz
+#define LCD_QUEUE_TIMER_COUNT		TIMER0_TOP(LCD_QUEUE_TICK_US)
+#define LCD_SLOW_CMD_TICKS			( LCD_SLOW_EXEC_TIME_US / LCD_QUEUE_TICK_US + 1 )
+
+#if LCD_USE_WRITE_QUEUE && !TIMER0_REACHABLE(LCD_QUEUE_TICK_US)
+#error "Timer0 cannot generate LCD queue tick from F_CPU"
+#endif
+
+//Shadow buffer macros
+#define LCD_DIRTY_BYTES		( ( LCD_CAPACITY + 7 ) / 8 )
+
+//CGRAM glyph cache macros
+#define LCD_GLYPH_SLOTS		8
+#define LCD_GLYPH_SIZE		8
+#define LCD_GLYPH_EMPTY		0				//Slots store sprite ID + 1, so zeroed slots are empty
+#define LCD_GLYPH_MAX_ID	254				//ID 255 would be stored as LCD_GLYPH_EMPTY
+#define LCD_GLYPH_MAX_AGE	0xFF
+
+//Streaming writer macros
+#define LCD_STREAM_NUL		-1				//String length is found from NUL terminator
+#define LCD_STREAM_RAM		0
+#define LCD_STREAM_PGM		1
+
+//Display shift scrolling macros
+#define SCROLL_LEFT			0
+#define SCROLL_RIGHT		1
+
+/*******************************************************************************************************
+										 STRUCTURE DEFINITION
+*******************************************************************************************************/
+
+typedef struct
+{
+	unsigned char byte, mode;
+}LCD_entry;
+
+/*******************************************************************************************************
+										  FUNCTION PROTOTYPES
+*******************************************************************************************************/
+
+//lcd.c
+void lcd_init(void);
+unsigned char lcd_read_busy(void);
+void lcd_wait_busy(void);
+void lcd_write(unsigned char, unsigned char);
+void lcd_latch(unsigned char);
+void lcd_command(unsigned char);
+void lcd_data(unsigned char);
+void lcd_stream(const char*, int, unsigned char);
+void lcd_printf(const char*, int, int);
+void lcd_write_n(const char*, int);
+void lcd_puts(const char*);
+void lcd_puts_P(const char*);
+void lcd_create_char(int, const unsigned char*);
+void lcd_create_char_P(int, const unsigned char*);
+void lcd_set_cursor(int, int);
+void lcd_get_cursor(int*, int*);
+void lcd_restore_cursor(int, int);
+
+void lcd_queue_put(unsigned char, unsigned char);
+void lcd_queue_service(void);
+unsigned char lcd_queue_depth(void);
+unsigned char lcd_queue_high_water(void);
+unsigned int lcd_queue_overflows(void);
+void lcd_queue_wait(void);
+
+//lcd_buffer.c
+void lcd_buffer_init(void);
+void lcd_buffer_clear(void);
+void lcd_buffer_write(int, int, unsigned char);
+void lcd_buffer_printf(const char*, int, int);
+void lcd_flush(void);
+
+//lcd_glyph.c
+void lcd_glyph_frame_begin(void);
+unsigned char lcd_glyph(unsigned char, const unsigned char*);
+
+//lcd_scroll.c
+void lcd_scroll_load(const char*, int);
+void lcd_scroll_step(int);
+unsigned char lcd_scroll_char(int);
+
+/*********************************************************************************************************/
+
+#endif
@@ -0,0 +1,178 @@
+/*******************************************************************************************************
+											 HEADER FILES
+*******************************************************************************************************/
+
+#include "lcd.h"
+
+/*******************************************************************************************************
+										    GLOBAL VARIABLES
+*******************************************************************************************************/
+
+unsigned char lcd_buffer[LCD_CAPACITY];			//Shadow copy of characters present in LCD
+unsigned char lcd_dirty[LCD_DIRTY_BYTES];		//One bit per cell which is yet to be sent to LCD
+
+/*******************************************************************************************************
+										  FUNCTION DEFINITIONS
+*******************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------
+	Function matches shadow buffer with LCD which is blank after lcd_init
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_buffer_init
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_buffer_init(void)
+{
+	int cell;
+
+	for (cell = 0; cell < LCD_CAPACITY; cell += 1)
+	{
+		lcd_buffer[cell] = LCD_BLANK;
+	}
+
+	for (cell = 0; cell < LCD_DIRTY_BYTES; cell += 1)
+	{
+		lcd_dirty[cell] = 0;
+	}
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function clears all characters of shadow buffer
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_buffer_clear
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_buffer_clear(void)
+{
+	int cell;
+
+	for (cell = 0; cell < LCD_CAPACITY; cell += 1)
+	{
+		lcd_buffer_write( cell % LINE_END, ( cell / LINE_END ) + LINE1, LCD_BLANK );
+	}
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function stores a character in shadow buffer and marks the cell as dirty if it has changed
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_buffer_write
+*
+*   Parameters 		:  	int pos				-	Position of character in line
+*						int line			-	Line in which character should be present
+*						unsigned char data	-	Character to be stored
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_buffer_write( int pos, int line, unsigned char data )
+{
+	int cell;
+
+	//Characters outside the display are clipped
+	if ( ( pos < LINE_START ) || ( pos >= LINE_END ) || ( line < LINE1 ) || ( line > LCD_LINES ) )
+	{
+		return;
+	}
+
+	cell = ( line - LINE1 ) * LINE_END + pos;
+
+	if ( lcd_buffer[cell] != data )
+	{
+		lcd_buffer[cell] = data;
+		lcd_dirty[cell / 8] |= (1 << (cell % 8));
+	}
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function stores string of data in shadow buffer
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_buffer_printf
+*
+*   Parameters 		:  	const char *str	-	String of characters
+*						int pos			-	Position of first character in line
+*						int line		-	Line of first character
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_buffer_printf( const char *str, int pos, int line )
+{
+	int char_num;
+
+	for (char_num = 0; *( str + char_num ) != '\0' ; char_num += 1)
+	{
+		if ( pos == LINE_END )
+		{
+			pos = LINE_START;
+			line += 1;
+		}
+		lcd_buffer_write( pos++, line, *(str + char_num) );
+	}
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function sends changed characters of shadow buffer to LCD
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_flush
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_flush(void)
+{
+	int cell, addr = -1;		//addr tracks the cell pointed by LCD address counter
+
+	for (cell = 0; cell < LCD_CAPACITY; cell += 1)
+	{
+		//Skipping 8 clean cells at once
+		if ( ( ( cell % 8 ) == 0 ) && ( lcd_dirty[cell / 8] == 0 ) )
+		{
+			cell += 7;
+			continue;
+		}
+
+		if ( ( lcd_dirty[cell / 8] & (1 << (cell % 8)) ) == 0 )
+		{
+			continue;
+		}
+
+		//Address is set only at start of each run of changed cells, LCD auto increments it within the run
+		if ( cell != addr )
+		{
+			lcd_set_cursor( cell % LINE_END, ( cell / LINE_END ) + LINE1 );
+		}
+
+		lcd_data( lcd_buffer[cell] );
+		lcd_dirty[cell / 8] &= ~(1 << (cell % 8));
+
+		//Address counter does not continue from end of one line to start of the next
+		addr = ( ( cell + 1 ) % LINE_END ) ? ( cell + 1 ) : -1;
+	}
+
+	return;
+}
+
+/*********************************************************************************************************/
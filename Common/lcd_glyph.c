@@ -0,0 +1,105 @@
+/*******************************************************************************************************
+											 HEADER FILES
+*******************************************************************************************************/
+
+#include "lcd.h"
+
+/*******************************************************************************************************
+										    GLOBAL VARIABLES
+*******************************************************************************************************/
+
+/*	CGRAM contents are unknown after power on, so glyph cache starts empty.
+ *	Slots hold sprite ID + 1, which lets the zeroed globals mean an empty cache	*/
+unsigned char lcd_glyph_id[LCD_GLYPH_SLOTS];	//Sprite stored in each CGRAM slot
+unsigned char lcd_glyph_age[LCD_GLYPH_SLOTS];	//Number of glyph lookups since slot was last used
+unsigned char lcd_glyph_visible;				//One bit per CGRAM slot used in current frame
+
+/*******************************************************************************************************
+										  FUNCTION DEFINITIONS
+*******************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------
+	Function starts a new frame, none of the CGRAM slots are visible yet
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_glyph_frame_begin
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_glyph_frame_begin(void)
+{
+	lcd_glyph_visible = 0;
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function returns CGRAM slot holding the sprite, uploading it on a cache miss
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_glyph
+*
+*   Parameters 		:  	unsigned char sprite_id			-	Index of sprite in sprite sheet, up to LCD_GLYPH_MAX_ID
+*						const unsigned char *sprites	-	Sprite sheet of 8 byte glyphs ( in PROGMEM )
+*
+*   Return     		: 	Character code of CGRAM slot, LCD_BLANK if all slots are visible in frame
+*						or sprite_id is above LCD_GLYPH_MAX_ID
+*-------------------------------------------------------------------------------------------------------*/
+
+unsigned char lcd_glyph( unsigned char sprite_id, const unsigned char *sprites )
+{
+	unsigned char slot, victim = LCD_GLYPH_SLOTS;
+
+	if ( sprite_id > LCD_GLYPH_MAX_ID )
+	{
+		return LCD_BLANK;
+	}
+
+	for (slot = 0; slot < LCD_GLYPH_SLOTS; slot += 1)
+	{
+		if ( lcd_glyph_id[slot] == sprite_id + 1 )
+		{
+			break;
+		}
+
+		//Least recently used slot which is not visible in current frame is evicted on a miss
+		if ( ( lcd_glyph_visible & (1 << slot) ) == 0 )
+		{
+			if ( ( victim == LCD_GLYPH_SLOTS ) || ( lcd_glyph_id[slot] == LCD_GLYPH_EMPTY ) ||
+				 ( ( lcd_glyph_id[victim] != LCD_GLYPH_EMPTY ) && ( lcd_glyph_age[slot] > lcd_glyph_age[victim] ) ) )
+			{
+				victim = slot;
+			}
+		}
+	}
+
+	if ( slot == LCD_GLYPH_SLOTS )
+	{
+		if ( victim == LCD_GLYPH_SLOTS )
+		{
+			return LCD_BLANK;		//A frame can not show more than 8 different glyphs
+		}
+
+		slot = victim;
+		lcd_glyph_id[slot] = sprite_id + 1;
+		lcd_create_char_P( slot, sprites + sprite_id * LCD_GLYPH_SIZE );
+	}
+
+	//Ageing all slots and marking this one as most recently used
+	for (victim = 0; victim < LCD_GLYPH_SLOTS; victim += 1)
+	{
+		if ( lcd_glyph_age[victim] < LCD_GLYPH_MAX_AGE )
+		{
+			lcd_glyph_age[victim] += 1;
+		}
+	}
+
+	lcd_glyph_age[slot] = 0;
+	lcd_glyph_visible |= (1 << slot);
+
+	return slot;
+}
+
+/*********************************************************************************************************/
@@ -0,0 +1,150 @@
+/*******************************************************************************************************
+											 HEADER FILES
+*******************************************************************************************************/
+
+#include "lcd.h"
+
+/*******************************************************************************************************
+										    GLOBAL VARIABLES
+*******************************************************************************************************/
+
+const char *scroll_str;			//String being scrolled
+int scroll_size;				//Number of characters in string
+int scroll_period;				//Number of characters after which scrolled text repeats
+int scroll_line;				//Line in which string is scrolled
+int scroll_column;				//DDRAM column shown at left edge of display
+int scroll_text;				//Position in text shown at left edge of display
+
+/*******************************************************************************************************
+										  FUNCTION DEFINITIONS
+*******************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------
+	Function loads string in DDRAM line for scrolling it with display shift
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_scroll_load
+*
+*   Parameters 		:  	const char *str	-	String to be scrolled
+*						int line		-	Line in which string is scrolled
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_scroll_load( const char *str, int line )
+{
+	int column, pos, cursor_line;
+
+	scroll_str = str;
+	scroll_line = line;
+	scroll_column = 0;
+	scroll_text = 0;
+
+	for (scroll_size = 0; *( str + scroll_size ) != '\0'; scroll_size += 1);
+
+	//Strings which fit in DDRAM line are padded with blanks, longer strings are followed by one blank screen
+	if ( scroll_size > DDRAM_LINE_SIZE )
+	{
+		scroll_period = scroll_size + LINE_END;
+	}
+	else
+	{
+		scroll_period = DDRAM_LINE_SIZE;
+	}
+
+	lcd_get_cursor( &pos, &cursor_line );
+
+	lcd_command( RET_HOME );			//Cancelling previous display shift
+
+	//Writing complete DDRAM line, address counter auto increments beyond the visible columns
+	lcd_set_cursor( LINE_START, line );
+
+	for (column = 0; column < DDRAM_LINE_SIZE; column += 1)
+	{
+		lcd_data( lcd_scroll_char( column ) );
+	}
+
+	//Cursor used by lcd_puts is left where it was, not past the end of the DDRAM line
+	lcd_restore_cursor( pos, cursor_line );
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function scrolls loaded string by one position using display shift
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_scroll_step
+*
+*   Parameters 		:  	int direction	-	SCROLL_LEFT or SCROLL_RIGHT
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_scroll_step( int direction )
+{
+	int column, text, pos, line;
+
+	if ( direction == SCROLL_LEFT )
+	{
+		lcd_command( SHIFT_ALL_LEFT );
+
+		scroll_column = ( scroll_column + 1 ) % DDRAM_LINE_SIZE;
+		scroll_text = ( scroll_text + 1 ) % scroll_period;
+
+		//Column which just left the display on the left comes back last from the right
+		column = ( scroll_column + DDRAM_LINE_SIZE - 1 ) % DDRAM_LINE_SIZE;
+		text = ( scroll_text + DDRAM_LINE_SIZE - 1 ) % scroll_period;
+	}
+	else
+	{
+		scroll_column = ( scroll_column + DDRAM_LINE_SIZE - 1 ) % DDRAM_LINE_SIZE;
+		scroll_text = ( scroll_text + scroll_period - 1 ) % scroll_period;
+
+		//Column which enters the display on the left is still hidden before the shift
+		column = scroll_column;
+		text = scroll_text;
+	}
+
+	//Strings longer than DDRAM line are windowed by rewriting the hidden column with next character
+	if ( scroll_period != DDRAM_LINE_SIZE )
+	{
+		lcd_get_cursor( &pos, &line );
+
+		lcd_restore_cursor( column, scroll_line );
+		lcd_data( lcd_scroll_char( text ) );
+
+		//Hidden column write does not move the cursor used by lcd_puts
+		lcd_restore_cursor( pos, line );
+	}
+
+	if ( direction != SCROLL_LEFT )
+	{
+		lcd_command( SHIFT_ALL_RIGHT );
+	}
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function returns character of scrolled text at given position
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	lcd_scroll_char
+*
+*   Parameters 		:  	int text	-	Position in scrolled text
+*
+*   Return     		: 	Character at position or blank
+*-------------------------------------------------------------------------------------------------------*/
+
+unsigned char lcd_scroll_char( int text )
+{
+	if ( text < scroll_size )
+	{
+		return *( scroll_str + text );
+	}
+
+	return LCD_BLANK;
+}
+
+/*********************************************************************************************************/
@@ -0,0 +1,253 @@
+/*******************************************************************************************************
+											 HEADER FILES
+*******************************************************************************************************/
+
+#include "sched.h"
+
+/*******************************************************************************************************
+									   GLOBAL VARIABLES AND ISRs
+*******************************************************************************************************/
+
+volatile uint16_t sched_tick;				//Milliseconds since sched_init, wraps every 65.5s
+
+SCHED_task sched_table[SCHED_MAX_TASKS];	//Registered tasks, lower index is dispatched first
+int sched_count;							//Number of registered tasks
+
+ISR( TIMER1_COMPA_vect )
+{
+	sched_tick += 1;
+}
+
+/*******************************************************************************************************
+										  FUNCTION DEFINITIONS
+*******************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------
+	Function checks whether release of a task has been reached at given tick
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	sched_released
+*
+*   Parameters 		:  	const SCHED_task *entry	-	Task table entry
+*						uint16_t tick			-	Scheduler tick
+*
+*   Return     		: 	1 when released, 0 otherwise
+*-------------------------------------------------------------------------------------------------------*/
+
+static int sched_released( const SCHED_task *entry, uint16_t tick )
+{
+	//Time since previous release is compared with the period, which holds for any period up to 65535ms
+	return (uint16_t)( tick - ( entry->release - entry->period ) ) >= entry->period;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function starts 1ms scheduler tick on Timer1
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	sched_init
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void sched_init(void)
+{
+	TCCR1A = 0x00;
+	TCNT1 = 0;
+	OCR1A = SCHED_TIMER_TOP;
+	TCCR1B = SCHED_TIMER_CTC | SCHED_TIMER_START;
+
+	TIMSK |= ( 1 << OCIE1A );
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function registers a periodic task, which is first released immediately
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	sched_add
+*
+*   Parameters 		:  	SCHED_fn task		-	Function run on every release
+*						uint16_t period		-	Time between releases ( 1 to 65535ms )
+*						uint16_t deadline	-	Time after release within which task has to complete ( in ms ),
+*												0 uses period as deadline
+*
+*   Return     		: 	Task ID or FAIL when task table is full
+*-------------------------------------------------------------------------------------------------------*/
+
+int sched_add( SCHED_fn task, uint16_t period, uint16_t deadline )
+{
+	SCHED_task *entry;
+
+	if ( sched_count == SCHED_MAX_TASKS )
+	{
+		return FAIL;
+	}
+
+	entry = &sched_table[sched_count];
+
+	entry->task = task;
+	entry->period = period;
+	entry->deadline = ( deadline == 0 ) ? period : deadline;
+	entry->release = sched_ticks();
+	entry->exec_us = 0;
+	entry->max_exec_us = 0;
+	entry->runs = 0;
+	entry->misses = 0;
+
+	sched_count += 1;
+
+	return sched_count - 1;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function changes period of a task, SCHED_SUSPENDED stops it and any other period resumes it
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	sched_set_period
+*
+*   Parameters 		:  	int id				-	Task ID returned by sched_add
+*						uint16_t period		-	New time between releases ( 1 to 65535ms )
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void sched_set_period( int id, uint16_t period )
+{
+	SCHED_task *entry = &sched_table[id];
+
+	//Resumed task is released immediately, running task keeps its next release
+	if ( entry->period == SCHED_SUSPENDED )
+	{
+		entry->release = sched_ticks();
+	}
+
+	entry->period = period;
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function runs every released task once, in order of registration
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	sched_dispatch
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void sched_dispatch(void)
+{
+	SCHED_task *entry;
+	uint16_t end_tick;
+	uint32_t start_us, exec_us;
+	int id;
+
+	for (id = 0; id < sched_count; id += 1)
+	{
+		entry = &sched_table[id];
+
+		if ( ( entry->period == SCHED_SUSPENDED ) || !sched_released( entry, sched_ticks() ) )
+		{
+			continue;
+		}
+
+		start_us = micros();
+		entry->task();
+		exec_us = micros() - start_us;
+		end_tick = sched_ticks();
+
+		//Execution time saturated at 16 bits
+		entry->exec_us = ( exec_us > 0xFFFF ) ? 0xFFFF : exec_us;
+
+		if ( entry->exec_us > entry->max_exec_us )
+		{
+			entry->max_exec_us = entry->exec_us;
+		}
+
+		if ( (uint16_t)( end_tick - entry->release ) >= entry->deadline )
+		{
+			entry->misses += 1;
+		}
+
+		entry->runs += 1;
+
+		//Task may have suspended itself
+		if ( entry->period == SCHED_SUSPENDED )
+		{
+			continue;
+		}
+
+		//Releases keep their phase, releases which passed while task overran are dropped
+		do
+		{
+			entry->release += entry->period;
+		}while ( sched_released( entry, end_tick ) );
+	}
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function dispatches tasks forever
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	sched_run
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void sched_run(void)
+{
+	while (1)
+	{
+		sched_dispatch();
+	}
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function returns milliseconds elapsed since sched_init
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	sched_ticks
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	Tick count, wraps every 65536ms
+*-------------------------------------------------------------------------------------------------------*/
+
+uint16_t sched_ticks(void)
+{
+	uint16_t tick;
+	uint8_t sreg = SREG;
+
+	cli();				//16 bit tick is read in two instructions
+	tick = sched_tick;
+	SREG = sreg;
+
+	return tick;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function returns timing statistics of a task
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	sched_task_stats
+*
+*   Parameters 		:  	int id	-	Task ID returned by sched_add
+*
+*   Return     		: 	Task table entry
+*-------------------------------------------------------------------------------------------------------*/
+
+const SCHED_task* sched_task_stats( int id )
+{
+	return &sched_table[id];
+}
+
+/*********************************************************************************************************/
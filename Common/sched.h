@@ -0,0 +1,79 @@
+#ifndef SCHED_H
+#define SCHED_H
+
+/*********************************************************************************************************
+											 HEADER FILES
+*********************************************************************************************************/
+
+#ifndef F_CPU
+#define F_CPU	8000000UL	//Setting clock at 8MHz
+#endif
+
+#include <stdint.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+#include "timer.h"
+#include "clock.h"			//Execution times are measured with micros()
+
+/*********************************************************************************************************
+								  CONFIGURATION ( overridden with -D at build time )
+*********************************************************************************************************/
+
+#ifndef SCHED_MAX_TASKS
+#define SCHED_MAX_TASKS			8			//Size of task table
+#endif
+
+/*********************************************************************************************************
+									  	   MACRO DEFINITIONS
+*********************************************************************************************************/
+
+#define PASS			0
+#define FAIL			-1
+
+//Timer1 in CTC mode interrupts once every millisecond, prescaler and compare value are chosen by compiler
+#define SCHED_TICK_US			1000
+#define SCHED_TIMER_CTC			( 1 << WGM12 )
+#define SCHED_TIMER_START		TIMER1_CS(SCHED_TICK_US)
+#define SCHED_TIMER_TOP			TIMER1_TOP(SCHED_TICK_US)
+
+#if !TIMER1_REACHABLE(SCHED_TICK_US)
+#error "Timer1 cannot generate scheduler tick from F_CPU"
+#endif
+
+#define SCHED_SUSPENDED			0			//Period of task which is not released any more
+
+/*******************************************************************************************************
+										 STRUCTURE DEFINITION
+*******************************************************************************************************/
+
+typedef void (*SCHED_fn)(void);
+
+//Task table entry, times are in ms except execution times which are in us
+typedef struct
+{
+	SCHED_fn task;					//Function run to completion on every release
+	uint16_t period;				//Time between releases, up to 65535ms, SCHED_SUSPENDED stops the task
+	uint16_t deadline;				//Time after release within which task has to complete
+	uint16_t release;				//Tick of next release
+	uint16_t exec_us;				//Execution time of last run
+	uint16_t max_exec_us;			//Longest execution time seen
+	uint16_t runs;					//Number of completed runs
+	uint16_t misses;				//Runs completed after their deadline
+}SCHED_task;
+
+/*******************************************************************************************************
+										  FUNCTION PROTOTYPES
+*******************************************************************************************************/
+
+void sched_init(void);
+int sched_add(SCHED_fn, uint16_t, uint16_t);
+void sched_set_period(int, uint16_t);
+void sched_run(void);
+void sched_dispatch(void);
+uint16_t sched_ticks(void);
+const SCHED_task* sched_task_stats(int);
+
+/*********************************************************************************************************/
+
+#endif
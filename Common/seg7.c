@@ -0,0 +1,370 @@
+/*******************************************************************************************************
+											 HEADER FILES
+*******************************************************************************************************/
+
+#include "seg7.h"
+#include "sched.h"
+
+/*******************************************************************************************************
+									  	   MACRO DEFINITIONS
+*******************************************************************************************************/
+
+//Glyphs built from segments, so the font follows SEG7_A - SEG7_G wiring
+#define GLYPH_0		( SEG7_A | SEG7_B | SEG7_C | SEG7_D | SEG7_E | SEG7_F )
+#define GLYPH_1		( SEG7_B | SEG7_C )
+#define GLYPH_2		( SEG7_A | SEG7_B | SEG7_D | SEG7_E | SEG7_G )
+#define GLYPH_3		( SEG7_A | SEG7_B | SEG7_C | SEG7_D | SEG7_G )
+#define GLYPH_4		( SEG7_B | SEG7_C | SEG7_F | SEG7_G )
+#define GLYPH_5		( SEG7_A | SEG7_C | SEG7_D | SEG7_F | SEG7_G )
+#define GLYPH_6		( SEG7_A | SEG7_C | SEG7_D | SEG7_E | SEG7_F | SEG7_G )
+#define GLYPH_7		( SEG7_A | SEG7_B | SEG7_C )
+#define GLYPH_8		( SEG7_A | SEG7_B | SEG7_C | SEG7_D | SEG7_E | SEG7_F | SEG7_G )
+#define GLYPH_9		( SEG7_A | SEG7_B | SEG7_C | SEG7_D | SEG7_F | SEG7_G )
+#define GLYPH_A		( SEG7_A | SEG7_B | SEG7_C | SEG7_E | SEG7_F | SEG7_G )
+#define GLYPH_B		( SEG7_C | SEG7_D | SEG7_E | SEG7_F | SEG7_G )				//b
+#define GLYPH_C		( SEG7_A | SEG7_D | SEG7_E | SEG7_F )
+#define GLYPH_D		( SEG7_B | SEG7_C | SEG7_D | SEG7_E | SEG7_G )				//d
+#define GLYPH_E		( SEG7_A | SEG7_D | SEG7_E | SEG7_F | SEG7_G )
+#define GLYPH_F		( SEG7_A | SEG7_E | SEG7_F | SEG7_G )
+
+/*******************************************************************************************************
+									   GLOBAL VARIABLES AND ISRs
+*******************************************************************************************************/
+
+const uint8_t seg7_hex_font[16] PROGMEM =
+{
+	GLYPH_0, GLYPH_1, GLYPH_2, GLYPH_3, GLYPH_4, GLYPH_5, GLYPH_6, GLYPH_7,
+	GLYPH_8, GLYPH_9, GLYPH_A, GLYPH_B, GLYPH_C, GLYPH_D, GLYPH_E, GLYPH_F
+};
+
+//Characters which cannot be drawn with seven segments are left blank
+const uint8_t seg7_font[SEG7_FONT_SIZE] PROGMEM =
+{
+	[ '-' - SEG7_FONT_FIRST ] = SEG7_G,
+	[ '_' - SEG7_FONT_FIRST ] = SEG7_D,
+	[ '=' - SEG7_FONT_FIRST ] = SEG7_D | SEG7_G,
+	[ '.' - SEG7_FONT_FIRST ] = SEG7_DP,
+	[ '0' - SEG7_FONT_FIRST ] = GLYPH_0,
+	[ '1' - SEG7_FONT_FIRST ] = GLYPH_1,
+	[ '2' - SEG7_FONT_FIRST ] = GLYPH_2,
+	[ '3' - SEG7_FONT_FIRST ] = GLYPH_3,
+	[ '4' - SEG7_FONT_FIRST ] = GLYPH_4,
+	[ '5' - SEG7_FONT_FIRST ] = GLYPH_5,
+	[ '6' - SEG7_FONT_FIRST ] = GLYPH_6,
+	[ '7' - SEG7_FONT_FIRST ] = GLYPH_7,
+	[ '8' - SEG7_FONT_FIRST ] = GLYPH_8,
+	[ '9' - SEG7_FONT_FIRST ] = GLYPH_9,
+	[ 'A' - SEG7_FONT_FIRST ] = GLYPH_A,
+	[ 'B' - SEG7_FONT_FIRST ] = GLYPH_B,
+	[ 'C' - SEG7_FONT_FIRST ] = GLYPH_C,
+	[ 'D' - SEG7_FONT_FIRST ] = GLYPH_D,
+	[ 'E' - SEG7_FONT_FIRST ] = GLYPH_E,
+	[ 'F' - SEG7_FONT_FIRST ] = GLYPH_F,
+	[ 'G' - SEG7_FONT_FIRST ] = SEG7_A | SEG7_C | SEG7_D | SEG7_E | SEG7_F,
+	[ 'H' - SEG7_FONT_FIRST ] = SEG7_B | SEG7_C | SEG7_E | SEG7_F | SEG7_G,
+	[ 'I' - SEG7_FONT_FIRST ] = SEG7_E | SEG7_F,
+	[ 'J' - SEG7_FONT_FIRST ] = SEG7_B | SEG7_C | SEG7_D | SEG7_E,
+	[ 'L' - SEG7_FONT_FIRST ] = SEG7_D | SEG7_E | SEG7_F,
+	[ 'N' - SEG7_FONT_FIRST ] = SEG7_C | SEG7_E | SEG7_G,						//n
+	[ 'O' - SEG7_FONT_FIRST ] = SEG7_C | SEG7_D | SEG7_E | SEG7_G,				//o
+	[ 'P' - SEG7_FONT_FIRST ] = SEG7_A | SEG7_B | SEG7_E | SEG7_F | SEG7_G,
+	[ 'R' - SEG7_FONT_FIRST ] = SEG7_E | SEG7_G,								//r
+	[ 'S' - SEG7_FONT_FIRST ] = GLYPH_5,
+	[ 'T' - SEG7_FONT_FIRST ] = SEG7_D | SEG7_E | SEG7_F | SEG7_G,				//t
+	[ 'U' - SEG7_FONT_FIRST ] = SEG7_B | SEG7_C | SEG7_D | SEG7_E | SEG7_F,
+	[ 'Y' - SEG7_FONT_FIRST ] = SEG7_B | SEG7_C | SEG7_D | SEG7_F | SEG7_G
+};
+
+volatile uint8_t seg7_fb[SEG7_DIGITS];		//Segment pattern of each digit
+uint8_t seg7_digit;							//Digit lit by scan interrupt
+uint8_t seg7_lit;							//Digit is lit and waits for end of its on time
+
+uint16_t seg7_blank;						//Timer1 counts with all digits off before next digit is lit
+uint16_t seg7_on[SEG7_DIGITS];				//Timer1 counts each digit stays lit
+uint8_t seg7_duty[SEG7_DIGITS];				//Relative brightness of each digit
+uint8_t seg7_brightness = SEG7_FULL;		//Brightness of whole display
+
+/*	Timer1 compare B matches twice in every scheduler tick. First match, after blanking interval,
+ *	lights next digit and moves compare B to end of its on time, where second match turns it off.
+ *	Segment port may share pins with LCD data lines. LCD queue interrupt then turns the lit digit off
+ *	through LCD_BUS_ACQUIRE while it uses them, and restores port and digit after each write.		*/
+ISR( TIMER1_COMPB_vect )
+{
+	uint16_t off;
+
+	SEG7_DIGIT_PORT &= ~SEG7_DIGIT_MASK;
+
+	if ( seg7_lit )
+	{
+		seg7_lit = 0;
+		OCR1B = seg7_blank;					//Next digit is lit in next tick
+		return;
+	}
+
+	seg7_digit += 1;
+	if ( seg7_digit == SEG7_DIGITS )
+	{
+		seg7_digit = 0;
+	}
+
+	if ( seg7_on[seg7_digit] == 0 )
+	{
+		return;								//Digit is dimmed out, compare B stays at blanking interval
+	}
+
+	SEG7_SEG_PORT = seg7_fb[seg7_digit];
+	SEG7_DIGIT_PORT |= ( 1 << seg7_digit );
+
+	off = seg7_blank + seg7_on[seg7_digit];
+	OCR1B = off;
+	seg7_lit = 1;
+
+	//Interrupt latency ate whole on time, compare B would only match again in next tick
+	if ( TCNT1 >= off )
+	{
+		SEG7_DIGIT_PORT &= ~SEG7_DIGIT_MASK;
+		seg7_lit = 0;
+		OCR1B = seg7_blank;
+	}
+}
+
+/*******************************************************************************************************
+										  FUNCTION DEFINITIONS
+*******************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------
+	Function starts scanning display, Timer1 has to be running as scheduler tick ( sched_init )
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	seg7_init
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void seg7_init(void)
+{
+	int digit;
+
+	SEG7_SEG_DDR = 0xFF;
+	SEG7_DIGIT_DDR |= SEG7_DIGIT_MASK;
+
+	seg7_clear();
+
+	for (digit = 0; digit < SEG7_DIGITS; digit += 1)
+	{
+		seg7_duty[digit] = SEG7_FULL;
+	}
+
+	seg7_set_blanking( SEG7_BLANK_US );		//Also works out on time of every digit
+
+	OCR1B = seg7_blank;
+	TIMSK |= ( 1 << OCIE1B );
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function works out on time of every digit from brightness, duty and blanking interval
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	seg7_update_on_time
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+static void seg7_update_on_time(void)
+{
+	uint16_t max_on, on;
+	uint8_t sreg;
+	int digit;
+
+	//Digit has to be off again before end of tick, so next tick starts with blanking interval
+	max_on = OCR1A - seg7_blank;
+
+	for (digit = 0; digit < SEG7_DIGITS; digit += 1)
+	{
+		on = (uint32_t)max_on * seg7_duty[digit] * seg7_brightness / ( (uint16_t)SEG7_FULL * SEG7_FULL );
+
+		sreg = SREG;
+		cli();						//16 bit value is read by scan interrupt
+		seg7_on[digit] = on;
+		SREG = sreg;
+	}
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function sets time for which all digits are off before next digit is lit
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	seg7_set_blanking
+*
+*   Parameters 		:  	uint16_t blank_us	-	Blanking interval ( in us ), clipped to half a tick
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void seg7_set_blanking( uint16_t blank_us )
+{
+	uint16_t blank;
+	uint8_t sreg;
+
+	if ( blank_us > SCHED_TICK_US / 2 )
+	{
+		blank_us = SCHED_TICK_US / 2;
+	}
+
+	blank = (uint32_t)blank_us * ( OCR1A + 1UL ) / SCHED_TICK_US;
+
+	sreg = SREG;
+	cli();
+	seg7_blank = blank;
+	SREG = sreg;
+
+	seg7_update_on_time();
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function sets brightness of whole display by scaling on time, refresh rate is not changed
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	seg7_set_brightness
+*
+*   Parameters 		:  	uint8_t level	-	0 ( off ) to SEG7_FULL
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void seg7_set_brightness( uint8_t level )
+{
+	seg7_brightness = level;
+	seg7_update_on_time();
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function sets relative brightness of one digit, evening out digits with different LED drops
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	seg7_set_duty
+*
+*   Parameters 		:  	int digit		-	Digit number, 0 is rightmost
+*						uint8_t duty	-	0 ( off ) to SEG7_FULL
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void seg7_set_duty( int digit, uint8_t duty )
+{
+	seg7_duty[digit] = duty;
+	seg7_update_on_time();
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function stores segment pattern of a digit, shown from next scan onwards
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	seg7_write
+*
+*   Parameters 		:  	int digit			-	Digit number, 0 is rightmost
+*						uint8_t segments	-	Segment pattern
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void seg7_write( int digit, uint8_t segments )
+{
+	seg7_fb[digit] = segments;		//Single byte store, scan interrupt never sees half a pattern
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function blanks all digits
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	seg7_clear
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void seg7_clear(void)
+{
+	int digit;
+
+	for (digit = 0; digit < SEG7_DIGITS; digit += 1)
+	{
+		seg7_fb[digit] = SEG7_BLANK;
+	}
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function returns segment pattern of a character
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	seg7_char
+*
+*   Parameters 		:  	char c	-	ASCII character
+*
+*   Return     		: 	Segment pattern, blank for characters not in font
+*-------------------------------------------------------------------------------------------------------*/
+
+uint8_t seg7_char( char c )
+{
+	if ( ( c >= 'a' ) && ( c <= 'z' ) )
+	{
+		c -= 'a' - 'A';
+	}
+
+	if ( ( c < SEG7_FONT_FIRST ) || ( c > SEG7_FONT_LAST ) )
+	{
+		return SEG7_BLANK;
+	}
+
+	return pgm_read_byte( &seg7_font[c - SEG7_FONT_FIRST] );
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function shows a short message starting from leftmost digit, remaining digits are blanked
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	seg7_puts
+*
+*   Parameters 		:  	const char *str	-	Message ( e.g. "Err", "SET" )
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void seg7_puts( const char *str )
+{
+	int digit;
+
+	for (digit = SEG7_DIGITS - 1; digit >= 0; digit -= 1)
+	{
+		if ( *str != '\0' )
+		{
+			seg7_fb[digit] = seg7_char( *str++ );
+		}
+		else
+		{
+			seg7_fb[digit] = SEG7_BLANK;
+		}
+	}
+
+	return;
+}
+
+/*********************************************************************************************************/
@@ -0,0 +1,87 @@
+#ifndef SEG7_H
+#define SEG7_H
+
+/*********************************************************************************************************
+											 HEADER FILES
+*********************************************************************************************************/
+
+#include <stdint.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+
+/*********************************************************************************************************
+								  CONFIGURATION ( overridden with -D at build time )
+*********************************************************************************************************/
+
+//Segments a - g and dot of all digits are driven from one port
+#ifndef SEG7_SEG_PORT
+#define SEG7_SEG_PORT		PORTB
+#define SEG7_SEG_DDR		DDRB
+#endif
+
+//Common pin of digit n is bit n of digit port, digit 0 is rightmost
+#ifndef SEG7_DIGIT_PORT
+#define SEG7_DIGIT_PORT		PORTA
+#define SEG7_DIGIT_DDR		DDRA
+#endif
+
+#ifndef SEG7_DIGITS
+#define SEG7_DIGITS			4
+#endif
+
+#ifndef SEG7_BLANK_US
+#define SEG7_BLANK_US		40			//All digits off between two digits, stops ghosting of next digit
+#endif
+
+//Port bit driving each segment
+#ifndef SEG7_A
+#define SEG7_A				( 1 << 1 )
+#define SEG7_B				( 1 << 2 )
+#define SEG7_C				( 1 << 3 )
+#define SEG7_D				( 1 << 4 )
+#define SEG7_E				( 1 << 5 )
+#define SEG7_F				( 1 << 6 )
+#define SEG7_G				( 1 << 7 )
+#define SEG7_DP				( 1 << 0 )
+#endif
+
+/*********************************************************************************************************
+									  	   MACRO DEFINITIONS
+*********************************************************************************************************/
+
+#define SEG7_DIGIT_MASK		( ( 1 << SEG7_DIGITS ) - 1 )
+#define SEG7_BLANK			0x00
+#define SEG7_FULL			255			//Full brightness and duty
+
+//Font covers ASCII from space to underscore, lower case letters are shown as upper case
+#define SEG7_FONT_FIRST		' '
+#define SEG7_FONT_LAST		'_'
+#define SEG7_FONT_SIZE		( SEG7_FONT_LAST - SEG7_FONT_FIRST + 1 )
+
+//Pattern of hex digit 0 - 15 in a single table load, OR with SEG7_DP for decimal point
+#define SEG7_HEX(n)			pgm_read_byte( &seg7_hex_font[(n)] )
+
+/*******************************************************************************************************
+										    GLOBAL VARIABLES
+*******************************************************************************************************/
+
+extern const uint8_t seg7_hex_font[16];
+extern const uint8_t seg7_font[SEG7_FONT_SIZE];
+
+/*******************************************************************************************************
+										  FUNCTION PROTOTYPES
+*******************************************************************************************************/
+
+void seg7_init(void);
+void seg7_write(int, uint8_t);
+void seg7_clear(void);
+void seg7_set_blanking(uint16_t);
+void seg7_set_brightness(uint8_t);
+void seg7_set_duty(int, uint8_t);
+uint8_t seg7_char(char);
+void seg7_puts(const char*);
+
+/*********************************************************************************************************/
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef TIMER_H
+#define TIMER_H
+
+/*********************************************************************************************************
+											 HEADER FILES
+*********************************************************************************************************/
+
+#ifndef F_CPU
+#define F_CPU	8000000UL	//Setting clock at 8MHz
+#endif
+
+#include <avr/io.h>
+
+/*********************************************************************************************************
+									  	   MACRO DEFINITIONS
+*********************************************************************************************************/
+
+/*	Prescaler and compare value of a timer period are worked out by the compiler from F_CPU,
+ *	so no division is done at run time. All macros are integer only and can also be used in
+ *	#if, which lets users reject unreachable periods with #error.
+ *
+ *	Periods are given in us. Counts are rounded to the nearest timer count.				*/
+
+#define TIMER_CYCLES(us)				( 1ULL * (F_CPU) * (us) / 1000000ULL )
+#define TIMER_COUNTS(us, presc)			( ( TIMER_CYCLES(us) + (presc) / 2 ) / (presc) )
+
+#define TIMER8_FITS(us, presc)			( TIMER_COUNTS(us, presc) <= 256ULL )
+#define TIMER16_FITS(us, presc)			( TIMER_COUNTS(us, presc) <= 65536ULL )
+
+//Clock select bits of each prescaler
+#define TIMER0_CS_1						( 1 << CS00 )
+#define TIMER0_CS_8						( 1 << CS01 )
+#define TIMER0_CS_64					( ( 1 << CS01 ) | ( 1 << CS00 ) )
+#define TIMER0_CS_256					( 1 << CS02 )
+#define TIMER0_CS_1024					( ( 1 << CS02 ) | ( 1 << CS00 ) )
+
+#define TIMER1_CS_1						( 1 << CS10 )
+#define TIMER1_CS_8						( 1 << CS11 )
+#define TIMER1_CS_64					( ( 1 << CS11 ) | ( 1 << CS10 ) )
+#define TIMER1_CS_256					( 1 << CS12 )
+#define TIMER1_CS_1024					( ( 1 << CS12 ) | ( 1 << CS10 ) )
+
+#define TIMER2_CS_1						( 1 << CS20 )
+#define TIMER2_CS_8						( 1 << CS21 )
+#define TIMER2_CS_32					( ( 1 << CS21 ) | ( 1 << CS20 ) )
+#define TIMER2_CS_64					( 1 << CS22 )
+#define TIMER2_CS_128					( ( 1 << CS22 ) | ( 1 << CS20 ) )
+#define TIMER2_CS_256					( ( 1 << CS22 ) | ( 1 << CS21 ) )
+#define TIMER2_CS_1024					( ( 1 << CS22 ) | ( 1 << CS21 ) | ( 1 << CS20 ) )
+
+/*	Smallest prescaler which fits period in timer, giving the finest resolution.
+ *	TIMERn_TOP is the compare value for CTC mode.										*/
+
+//Timer0, 8 bit
+#define TIMER0_PRESCALER(us)			( TIMER8_FITS(us, 1) ? 1 : TIMER8_FITS(us, 8) ? 8 : TIMER8_FITS(us, 64) ? 64 : \
+										  TIMER8_FITS(us, 256) ? 256 : 1024 )
+#define TIMER0_CS(us)					( TIMER8_FITS(us, 1) ? TIMER0_CS_1 : TIMER8_FITS(us, 8) ? TIMER0_CS_8 : \
+										  TIMER8_FITS(us, 64) ? TIMER0_CS_64 : TIMER8_FITS(us, 256) ? TIMER0_CS_256 : TIMER0_CS_1024 )
+#define TIMER0_TOP(us)					( TIMER_COUNTS(us, TIMER0_PRESCALER(us)) - 1 )
+#define TIMER0_REACHABLE(us)			( TIMER_COUNTS(us, 1) >= 2 && TIMER8_FITS(us, 1024) )
+
+//Timer1, 16 bit
+#define TIMER1_PRESCALER(us)			( TIMER16_FITS(us, 1) ? 1 : TIMER16_FITS(us, 8) ? 8 : TIMER16_FITS(us, 64) ? 64 : \
+										  TIMER16_FITS(us, 256) ? 256 : 1024 )
+#define TIMER1_CS(us)					( TIMER16_FITS(us, 1) ? TIMER1_CS_1 : TIMER16_FITS(us, 8) ? TIMER1_CS_8 : \
+										  TIMER16_FITS(us, 64) ? TIMER1_CS_64 : TIMER16_FITS(us, 256) ? TIMER1_CS_256 : TIMER1_CS_1024 )
+#define TIMER1_TOP(us)					( TIMER_COUNTS(us, TIMER1_PRESCALER(us)) - 1 )
+#define TIMER1_REACHABLE(us)			( TIMER_COUNTS(us, 1) >= 2 && TIMER16_FITS(us, 1024) )
+
+//Timer2, 8 bit with two extra prescalers
+#define TIMER2_PRESCALER(us)			( TIMER8_FITS(us, 1) ? 1 : TIMER8_FITS(us, 8) ? 8 : TIMER8_FITS(us, 32) ? 32 : \
+										  TIMER8_FITS(us, 64) ? 64 : TIMER8_FITS(us, 128) ? 128 : TIMER8_FITS(us, 256) ? 256 : 1024 )
+#define TIMER2_CS(us)					( TIMER8_FITS(us, 1) ? TIMER2_CS_1 : TIMER8_FITS(us, 8) ? TIMER2_CS_8 : \
+										  TIMER8_FITS(us, 32) ? TIMER2_CS_32 : TIMER8_FITS(us, 64) ? TIMER2_CS_64 : \
+										  TIMER8_FITS(us, 128) ? TIMER2_CS_128 : TIMER8_FITS(us, 256) ? TIMER2_CS_256 : TIMER2_CS_1024 )
+#define TIMER2_TOP(us)					( TIMER_COUNTS(us, TIMER2_PRESCALER(us)) - 1 )
+#define TIMER2_REACHABLE(us)			( TIMER_COUNTS(us, 1) >= 2 && TIMER8_FITS(us, 1024) )
+
+/*********************************************************************************************************/
+
+#endif
@@ -0,0 +1,19 @@
+/*********************************************************************************************************
+					   HOST REPLACEMENT OF <avr/interrupt.h> FOR THE HD44780 EMULATOR
+*********************************************************************************************************/
+#ifndef HD_AVR_INTERRUPT_H
+#define HD_AVR_INTERRUPT_H
+
+#include <avr/io.h>
+
+//Interrupt handlers become plain functions which the emulator calls on timer compare match
+#define ISR(vector)		void vector(void)
+
+#define sei()			( SREG |= (1 << SREG_I) )
+#define cli()			( SREG &= (uint8_t)~(1 << SREG_I) )
+
+void TIMER0_COMP_vect(void);
+
+#endif
+
+/*********************************************************************************************************/
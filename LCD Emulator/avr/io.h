@@ -0,0 +1,54 @@
+/*********************************************************************************************************
+						   HOST REPLACEMENT OF <avr/io.h> FOR THE HD44780 EMULATOR
+*********************************************************************************************************/
+#ifndef HD_AVR_IO_H
+#define HD_AVR_IO_H
+
+#include "../hd44780.h"
+
+//Registers touched by LCD library, all of them are routed to the HD44780 model
+enum
+{
+	HD_PORTB, HD_DDRB, HD_PINB,
+	HD_PORTD, HD_DDRD, HD_PIND,
+	HD_TCCR0, HD_OCR0, HD_TIMSK, HD_SREG,
+	HD_REG_COUNT
+};
+
+extern HD_reg PORTB, DDRB, PINB;
+extern HD_reg PORTD, DDRD, PIND;
+extern HD_reg TCCR0, OCR0, TIMSK, SREG;
+
+//Port pins
+#define PB0		0
+#define PB1		1
+#define PB2		2
+#define PB3		3
+#define PB4		4
+#define PB5		5
+#define PB6		6
+#define PB7		7
+
+#define PD0		0
+#define PD1		1
+#define PD2		2
+#define PD3		3
+#define PD4		4
+#define PD5		5
+#define PD6		6
+#define PD7		7
+
+//Timer0 bits
+#define CS00	0
+#define CS01	1
+#define CS02	2
+#define WGM01	3
+#define WGM00	6
+#define OCIE0	1
+#define TOIE0	0
+
+#define SREG_I	7
+
+#endif
+
+/*********************************************************************************************************/
@@ -0,0 +1,14 @@
+/*********************************************************************************************************
+					   HOST REPLACEMENT OF <avr/pgmspace.h> FOR THE HD44780 EMULATOR
+*********************************************************************************************************/
+#ifndef HD_AVR_PGMSPACE_H
+#define HD_AVR_PGMSPACE_H
+
+//Host has a single address space, program memory reads are plain reads
+#define PROGMEM
+#define pgm_read_byte(addr)		( *(const unsigned char*)( addr ) )
+#define PSTR(str)				( str )
+
+#endif
+
+/*********************************************************************************************************/
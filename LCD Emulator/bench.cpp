@@ -0,0 +1,539 @@
+/*******************************************************************************************************
+*   TASK :
+*
+* 	1. Run LCD library against HD44780 model on the build machine
+*	2. Report bus time of typical frames drawn by the projects
+*	3. Fail when LCD is written while busy, bus timing is violated or display content is wrong
+*
+********************************************************************************************************
+											 HEADER FILES
+*******************************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "lcd.h"
+#include "hd44780.h"
+
+/*******************************************************************************************************
+									  	   MACRO DEFINITIONS
+*******************************************************************************************************/
+
+#define BENCH_REPEAT		40			//Frames averaged for repeated frames
+#define BENCH_SPRITE		0
+
+//Glyph cache test uses more sprites than CGRAM slots, first two are the game sprites
+#define BENCH_SPRITES		14
+#define BENCH_CACHE_FIRST	2
+#define BENCH_GLYPH(n)		{ n, 0x1F - n, n, 0x11, n, 0x0A, n, 0x04 }
+
+#define BENCH_SCROLL_LONG	( DDRAM_LINE_SIZE + 17 )	//Scrolled string longer than DDRAM line
+
+/*******************************************************************************************************
+										    GLOBAL VARIABLES
+*******************************************************************************************************/
+
+static int failures = 0;
+
+unsigned long bench_bus_acquired = 0, bench_bus_released = 0;	//Counted by bus hooks in lcd_config.h
+
+static const char bench_banner[] PROGMEM = "PROGMEM string wraps at row end";
+
+static const unsigned char bench_sprites[BENCH_SPRITES][LCD_GLYPH_SIZE] PROGMEM =
+{
+	{ 0x0E, 0x0E, 0x04, 0x1F, 0x04, 0x0A, 0x11, 0x00 },
+	{ 0x00, 0x04, 0x0E, 0x1F, 0x1F, 0x0E, 0x04, 0x00 },
+	BENCH_GLYPH(2), BENCH_GLYPH(3), BENCH_GLYPH(4), BENCH_GLYPH(5), BENCH_GLYPH(6), BENCH_GLYPH(7),
+	BENCH_GLYPH(8), BENCH_GLYPH(9), BENCH_GLYPH(10), BENCH_GLYPH(11), BENCH_GLYPH(12), BENCH_GLYPH(13)
+};
+
+/*******************************************************************************************************
+										  FUNCTION DEFINITIONS
+*******************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------
+	Function prints statistics of a frame and counts failures
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	bench_report
+*
+*   Parameters 		:  	const char *name	-	Name of frame
+*						HD_stats total		-	Statistics summed over all repeats
+*						int repeat			-	Number of frames measured
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+static void bench_report( const char *name, HD_stats total, int repeat )
+{
+	printf( "%-22s %10.1f %10.1f %7.1f %7.1f %8.1f %6lu %6lu\n", name,
+			( total.idle_ns - total.start_ns ) / 1000.0 / repeat,
+			( total.cpu_ns - total.start_ns ) / 1000.0 / repeat,
+			(double)total.commands / repeat, (double)total.data / repeat,
+			(double)total.busy_reads / repeat, total.busy_writes, total.timing_errors );
+
+	if ( total.busy_writes || total.timing_errors )
+	{
+		failures++;
+	}
+
+	//Queue is drained at end of frame, so each acquired bus has been released
+	if ( bench_bus_acquired != bench_bus_released )
+	{
+		printf( "%s: bus acquired %lu times, released %lu times\n", name, bench_bus_acquired, bench_bus_released );
+		bench_bus_released = bench_bus_acquired;
+		failures++;
+	}
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function adds statistics of one frame to running total
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	bench_add
+*
+*   Parameters 		:  	HD_stats *total	-	Running total
+*						HD_stats frame	-	Statistics of frame
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+static void bench_add( HD_stats *total, HD_stats frame )
+{
+	total->idle_ns += frame.idle_ns - frame.start_ns;
+	total->cpu_ns += frame.cpu_ns - frame.start_ns;
+	total->commands += frame.commands;
+	total->data += frame.data;
+	total->busy_reads += frame.busy_reads;
+	total->busy_writes += frame.busy_writes;
+	total->timing_errors += frame.timing_errors;
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function compares visible display with expected text
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	bench_expect
+*
+*   Parameters 		:  	const char *name	-	Name of frame
+*						const char *text	-	Expected characters, LCD_COLUMNS per row
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+static void bench_expect( const char *name, const char *text )
+{
+	char line[LCD_COLUMNS + 1];
+	int row;
+
+	for (row = 0; row < LCD_LINES; row += 1)
+	{
+		hd_visible_line( row, line );
+		if ( strncmp( line, text + row * LCD_COLUMNS, LCD_COLUMNS ) != 0 )
+		{
+			printf( "%s: row %d shows \"%s\", expected \"%.*s\"\n", name, row, line, LCD_COLUMNS, text + row * LCD_COLUMNS );
+			failures++;
+		}
+	}
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function fills text with a pattern covering whole display
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	bench_pattern
+*
+*   Parameters 		:  	char *text	-	Receives LCD_CAPACITY characters and NUL
+*						char first	-	First character of pattern
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+static void bench_pattern( char *text, char first )
+{
+	int cell;
+
+	for (cell = 0; cell < LCD_CAPACITY; cell += 1)
+	{
+		text[cell] = first + cell % 26;
+	}
+	text[LCD_CAPACITY] = '\0';
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function checks that CGRAM slot holds given sprite
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	bench_expect_glyph
+*
+*   Parameters 		:  	const char *name	-	Name of check
+*						unsigned char slot	-	CGRAM slot returned by lcd_glyph
+*						int sprite			-	Index of sprite in bench_sprites
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+static void bench_expect_glyph( const char *name, unsigned char slot, int sprite )
+{
+	int row;
+
+	if ( slot >= LCD_GLYPH_SLOTS )
+	{
+		printf( "%s: sprite %d got no CGRAM slot\n", name, sprite );
+		failures++;
+		return;
+	}
+
+	for (row = 0; row < LCD_GLYPH_SIZE; row += 1)
+	{
+		if ( hd_cgram( slot * LCD_GLYPH_SIZE + row ) != bench_sprites[sprite][row] )
+		{
+			printf( "%s: CGRAM slot %d does not hold sprite %d\n", name, slot, sprite );
+			failures++;
+			return;
+		}
+	}
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function compares first line with the window of a scrolled string
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	bench_expect_scroll
+*
+*   Parameters 		:  	const char *name	-	Name of check
+*						const char *str		-	String loaded with lcd_scroll_load
+*						int offset			-	Position in scrolled text expected at left edge
+*
+*   Return     		: 	0 when line matches, -1 otherwise
+*-------------------------------------------------------------------------------------------------------*/
+
+static int bench_expect_scroll( const char *name, const char *str, int offset )
+{
+	char line[LCD_COLUMNS + 1], expected[LCD_COLUMNS + 1];
+	int size = strlen( str ), period, column, text;
+
+	//Same repeat as lcd_scroll_load, long strings are followed by one blank screen
+	period = ( size > DDRAM_LINE_SIZE ) ? size + LINE_END : DDRAM_LINE_SIZE;
+
+	for (column = 0; column < LCD_COLUMNS; column += 1)
+	{
+		text = ( offset + column ) % period;
+		expected[column] = ( text < size ) ? str[text] : LCD_BLANK;
+	}
+	expected[LCD_COLUMNS] = '\0';
+
+	hd_visible_line( 0, line );
+	if ( strcmp( line, expected ) != 0 )
+	{
+		printf( "%s: offset %d shows \"%s\", expected \"%s\"\n", name, offset, line, expected );
+		failures++;
+		return -1;
+	}
+
+	return 0;
+}
+
+/*******************************************************************************************************
+										    MAIN FUNCTION
+*******************************************************************************************************/
+
+int main(void)
+{
+	HD_stats total, stats;
+	char text[LCD_CAPACITY + 1], expected[LCD_CAPACITY + 1];
+	char long_text[BENCH_SCROLL_LONG + 1];
+	unsigned char slot[BENCH_SPRITES], evicted;
+	int frame, cell, sprite, offset, period;
+
+	hd_reset();
+	sei();					//Write queue is drained by Timer0 interrupt
+
+	printf( "LCD_BUS_WIDTH=%d LCD_USE_BUSY_FLAG=%d LCD_USE_WRITE_QUEUE=%d %dx%d\n\n",
+			LCD_BUS_WIDTH, LCD_USE_BUSY_FLAG, LCD_USE_WRITE_QUEUE, LCD_COLUMNS, LCD_LINES );
+	printf( "%-22s %10s %10s %7s %7s %8s %6s %6s\n", "frame", "bus us", "cpu us", "cmds", "data", "polls", "busy", "timing" );
+
+	//Power on initialisation
+	hd_frame_begin();
+	lcd_init();
+	lcd_buffer_init();
+	hd_frame_cpu_done();
+	memset( &total, 0, sizeof( total ) );
+	bench_add( &total, hd_frame_end() );
+	bench_report( "lcd_init", total, 1 );
+
+	//Whole screen written with lcd_printf
+	bench_pattern( text, 'A' );
+	hd_frame_begin();
+	lcd_set_cursor( LINE_START, LINE1 );
+	lcd_printf( text, 0, LCD_CAPACITY );
+	hd_frame_cpu_done();
+	memset( &total, 0, sizeof( total ) );
+	bench_add( &total, hd_frame_end() );
+	bench_report( "lcd_printf full", total, 1 );
+	bench_expect( "lcd_printf full", text );
+
+	//Whole screen written from a NUL terminated string
+	bench_pattern( text, 'K' );
+	hd_frame_begin();
+	lcd_set_cursor( LINE_START, LINE1 );
+	lcd_puts( text );
+	hd_frame_cpu_done();
+	memset( &total, 0, sizeof( total ) );
+	bench_add( &total, hd_frame_end() );
+	bench_report( "lcd_puts full", total, 1 );
+	bench_expect( "lcd_puts full", text );
+
+	//String from program memory on a cleared display
+	lcd_command( CLR_SCR );
+	hd_frame_end();
+
+	hd_frame_begin();
+	lcd_puts_P( bench_banner );
+	hd_frame_cpu_done();
+	memset( &total, 0, sizeof( total ) );
+	bench_add( &total, hd_frame_end() );
+	bench_report( "lcd_puts_P", total, 1 );
+
+	//Longer banner wraps back over itself on small displays
+	if ( sizeof( bench_banner ) <= sizeof( expected ) )
+	{
+		memset( expected, LCD_BLANK, LCD_CAPACITY );
+		memcpy( expected, bench_banner, sizeof( bench_banner ) - 1 );
+		expected[LCD_CAPACITY] = '\0';
+		bench_expect( "lcd_puts_P", expected );
+	}
+
+	//Whole screen redrawn through shadow buffer
+	bench_pattern( text, 'a' );
+	hd_frame_begin();
+	lcd_buffer_clear();
+	lcd_buffer_printf( text, LINE_START, LINE1 );
+	lcd_flush();
+	hd_frame_cpu_done();
+	memset( &total, 0, sizeof( total ) );
+	bench_add( &total, hd_frame_end() );
+	bench_report( "buffer full", total, 1 );
+	bench_expect( "buffer full", text );
+
+	//Game frames, a sprite runs along line 2 under a score on line 1
+	memset( &total, 0, sizeof( total ) );
+	for (frame = 0; frame < BENCH_REPEAT; frame += 1)
+	{
+		hd_frame_begin();
+		lcd_buffer_clear();
+		lcd_glyph_frame_begin();
+		lcd_buffer_write( frame % LINE_END, LINE2, lcd_glyph( BENCH_SPRITE + frame % 2, &bench_sprites[0][0] ) );
+		lcd_buffer_write( LINE_END - 1 - frame % LINE_END, LINE2, '#' );
+		snprintf( text, sizeof( text ), "%d", frame * 10 );
+		lcd_buffer_printf( text, LINE_END - 4, LINE1 );
+		lcd_flush();
+		hd_frame_cpu_done();
+		bench_add( &total, hd_frame_end() );
+	}
+	bench_report( "buffer sprite frame", total, BENCH_REPEAT );
+
+	for (cell = 0; cell < LCD_GLYPH_SIZE; cell += 1)
+	{
+		if ( hd_cgram( lcd_glyph( BENCH_SPRITE, &bench_sprites[0][0] ) * LCD_GLYPH_SIZE + cell ) != bench_sprites[BENCH_SPRITE][cell] )
+		{
+			printf( "glyph cache: CGRAM does not hold sprite\n" );
+			failures++;
+			break;
+		}
+	}
+	lcd_queue_wait();
+
+	//Glyph cache, all 8 slots taken in one frame
+	lcd_command( CLR_SCR );
+	hd_frame_end();
+
+	lcd_glyph_frame_begin();
+	for (sprite = BENCH_CACHE_FIRST; sprite < BENCH_CACHE_FIRST + LCD_GLYPH_SLOTS; sprite += 1)
+	{
+		slot[sprite] = lcd_glyph( sprite, &bench_sprites[0][0] );
+	}
+	hd_frame_end();
+
+	for (sprite = BENCH_CACHE_FIRST; sprite < BENCH_CACHE_FIRST + LCD_GLYPH_SLOTS; sprite += 1)
+	{
+		bench_expect_glyph( "glyph fill", slot[sprite], sprite );
+
+		for (cell = BENCH_CACHE_FIRST; cell < sprite; cell += 1)
+		{
+			if ( slot[cell] == slot[sprite] )
+			{
+				printf( "glyph fill: sprites %d and %d share slot %d\n", cell, sprite, slot[sprite] );
+				failures++;
+			}
+		}
+	}
+
+	//Ninth sprite cannot be shown while all slots are visible
+	if ( lcd_glyph( BENCH_CACHE_FIRST + LCD_GLYPH_SLOTS, &bench_sprites[0][0] ) != LCD_BLANK )
+	{
+		printf( "glyph fill: ninth sprite of a frame got a slot\n" );
+		failures++;
+	}
+
+	if ( lcd_glyph( 255, &bench_sprites[0][0] ) != LCD_BLANK )
+	{
+		printf( "glyph fill: sprite ID 255 got a slot\n" );
+		failures++;
+	}
+
+	//Next frame shows first four sprites again, they are hits and send nothing to LCD
+	hd_frame_begin();
+	lcd_glyph_frame_begin();
+	for (sprite = BENCH_CACHE_FIRST; sprite < BENCH_CACHE_FIRST + 4; sprite += 1)
+	{
+		if ( lcd_glyph( sprite, &bench_sprites[0][0] ) != slot[sprite] )
+		{
+			printf( "glyph hit: sprite %d moved to another slot\n", sprite );
+			failures++;
+		}
+	}
+	stats = hd_frame_end();
+	if ( stats.commands + stats.data != 0 )
+	{
+		printf( "glyph hit: cached sprites were uploaded again\n" );
+		failures++;
+	}
+
+	//Four new sprites evict the four least recently used, text written around uploads stays in DDRAM
+	lcd_set_cursor( LINE_START, LINE1 );
+	lcd_puts( "AB" );
+	for (sprite = BENCH_CACHE_FIRST + LCD_GLYPH_SLOTS; sprite < BENCH_SPRITES; sprite += 1)
+	{
+		slot[sprite] = lcd_glyph( sprite, &bench_sprites[0][0] );
+	}
+	lcd_puts( "CD" );
+	hd_frame_end();
+
+	for (sprite = BENCH_CACHE_FIRST + LCD_GLYPH_SLOTS; sprite < BENCH_SPRITES; sprite += 1)
+	{
+		bench_expect_glyph( "glyph evict", slot[sprite], sprite );
+
+		for (evicted = 0, cell = BENCH_CACHE_FIRST + 4; cell < BENCH_CACHE_FIRST + LCD_GLYPH_SLOTS; cell += 1)
+		{
+			evicted |= ( slot[cell] == slot[sprite] );
+		}
+
+		if ( !evicted )
+		{
+			printf( "glyph evict: sprite %d took slot %d of a recently used sprite\n", sprite, slot[sprite] );
+			failures++;
+		}
+	}
+
+	for (sprite = BENCH_CACHE_FIRST; sprite < BENCH_CACHE_FIRST + 4; sprite += 1)
+	{
+		bench_expect_glyph( "glyph evict", slot[sprite], sprite );
+	}
+
+	memset( expected, LCD_BLANK, LCD_CAPACITY );
+	memcpy( expected, "ABCD", 4 );
+	expected[LCD_CAPACITY] = '\0';
+	bench_expect( "glyph upload cursor", expected );
+
+	//Display shift scrolling, starting from a blank display
+	lcd_command( CLR_SCR );
+	hd_frame_end();
+
+	bench_pattern( text, '0' );
+	text[LINE_END] = '\0';
+	hd_frame_begin();
+	lcd_scroll_load( text, LINE1 );
+	hd_frame_cpu_done();
+	memset( &total, 0, sizeof( total ) );
+	bench_add( &total, hd_frame_end() );
+	bench_report( "scroll load", total, 1 );
+
+	memset( &total, 0, sizeof( total ) );
+	for (frame = 0; frame < DDRAM_LINE_SIZE; frame += 1)
+	{
+		hd_frame_begin();
+		lcd_scroll_step( SCROLL_LEFT );
+		hd_frame_cpu_done();
+		bench_add( &total, hd_frame_end() );
+	}
+	bench_report( "scroll step", total, DDRAM_LINE_SIZE );
+
+	//A full turn of display shift brings the text back to its place
+	memset( expected, LCD_BLANK, LCD_CAPACITY );
+	memcpy( expected, text, LINE_END );
+	expected[LCD_CAPACITY] = '\0';
+	bench_expect( "scroll step", expected );
+
+	//String longer than DDRAM line is windowed through hidden column, both directions
+	lcd_command( CLR_SCR );
+	hd_frame_end();
+
+	for (cell = 0; cell < BENCH_SCROLL_LONG; cell += 1)
+	{
+		long_text[cell] = 'a' + cell % 26;
+	}
+	long_text[BENCH_SCROLL_LONG] = '\0';
+	period = BENCH_SCROLL_LONG + LINE_END;
+
+	lcd_scroll_load( long_text, LINE1 );
+	hd_frame_end();
+	bench_expect_scroll( "scroll long", long_text, 0 );
+
+	memset( &total, 0, sizeof( total ) );
+	for (offset = 1; offset <= 2 * period; offset += 1)
+	{
+		hd_frame_begin();
+		lcd_scroll_step( SCROLL_LEFT );
+		hd_frame_cpu_done();
+		bench_add( &total, hd_frame_end() );
+
+		if ( bench_expect_scroll( "scroll long left", long_text, offset % period ) )
+		{
+			break;
+		}
+	}
+	bench_report( "scroll step long", total, 2 * period );
+
+	for (offset = 2 * period - 1; offset >= period - 5; offset -= 1)
+	{
+		lcd_scroll_step( SCROLL_RIGHT );
+		hd_frame_end();
+
+		if ( bench_expect_scroll( "scroll long right", long_text, offset % period ) )
+		{
+			break;
+		}
+	}
+
+	//Cursor used by lcd_puts is not moved by hidden column write, home position shows line 2 unshifted
+	lcd_set_cursor( LINE_START, LINE2 );
+	lcd_puts( "X" );
+	lcd_scroll_step( SCROLL_LEFT );
+	lcd_puts( "Y" );
+	lcd_command( RET_HOME );
+	hd_frame_end();
+
+	hd_visible_line( 1, text );
+	if ( strncmp( text, "XY", 2 ) != 0 )
+	{
+		printf( "scroll long cursor: line 2 shows \"%s\", expected \"XY\" at start\n", text );
+		failures++;
+	}
+
+	printf( "\n%s\n", failures ? "FAIL" : "PASS" );
+
+	return failures ? 1 : 0;
+}
+
+/*********************************************************************************************************/
@@ -0,0 +1,707 @@
+/*******************************************************************************************************
+*   HD44780 model driven by the I/O register writes of the LCD library.
+*
+*	Control and data lines are decoded with the wiring chosen in lcd_config.h,
+*	so the same model checks 8 bit and 4 bit builds. Simulated time advances on
+*	every register access and on _delay_us / _delay_ms, and Timer0 compare
+*	match interrupts are delivered for builds using the LCD write queue.
+*
+********************************************************************************************************
+											 HEADER FILES
+*******************************************************************************************************/
+
+#include <string.h>
+
+#include "lcd.h"
+#include "hd44780.h"
+
+/*******************************************************************************************************
+										  STRUCTURE DEFINITION
+*******************************************************************************************************/
+
+typedef struct
+{
+	uint8_t ddram[HD_DDRAM_SIZE];
+	uint8_t cgram[HD_CGRAM_SIZE];
+	uint8_t ac;						//Address counter
+	int cgram_mode;					//Address counter points to CGRAM
+	int increment;					//I/D bit of entry mode
+	int shift_entry;				//S bit of entry mode
+	int shift;						//Display shift in characters
+	int eight_bit;					//DL bit of function set
+	int two_line;					//N bit of function set
+	int nibble_pending;				//High nibble received in 4 bit mode
+	uint8_t nibble_high;
+	int read_phase;					//Nibble of busy flag read being clocked out in 4 bit mode
+	int enable;						//Level of EN line
+	uint64_t enable_rise_ns;
+	uint64_t busy_until_ns;			//Time at which current instruction finishes
+}HD_state;
+
+/*******************************************************************************************************
+										    GLOBAL VARIABLES
+*******************************************************************************************************/
+
+static uint8_t reg_value[HD_REG_COUNT];
+
+HD_reg PORTB( HD_PORTB ), DDRB( HD_DDRB ), PINB( HD_PINB );
+HD_reg PORTD( HD_PORTD ), DDRD( HD_DDRD ), PIND( HD_PIND );
+HD_reg TCCR0( HD_TCCR0 ), OCR0( HD_OCR0 ), TIMSK( HD_TIMSK ), SREG( HD_SREG );
+
+static HD_state hd;
+static HD_stats stats;
+
+static uint64_t now_ns;				//Simulated time since power on
+static uint64_t compare_ns;			//Time of next Timer0 compare match
+static int compare_flag;			//OCF0, compare match happened while interrupt was masked
+static int in_isr;
+
+/*******************************************************************************************************
+										  FUNCTION DEFINITIONS
+*******************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------
+	Function returns Timer0 compare match period, 0 if timer is stopped
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	hd_timer_period
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	Period in ns
+*-------------------------------------------------------------------------------------------------------*/
+
+static uint64_t hd_timer_period(void)
+{
+	static const uint64_t prescalar[8] = { 0, 1, 8, 64, 256, 1024, 0, 0 };
+	uint64_t clocks;
+
+	clocks = prescalar[reg_value[HD_TCCR0] & 0x07] * ( reg_value[HD_OCR0] + 1UL );
+
+	return ( clocks * 1000000000UL ) / F_CPU;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function runs Timer0 compare interrupt if it is enabled and not masked
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	hd_timer_interrupt
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+static void hd_timer_interrupt(void)
+{
+	if ( in_isr || ( reg_value[HD_TIMSK] & (1 << OCIE0) ) == 0 || ( reg_value[HD_SREG] & (1 << SREG_I) ) == 0 )
+	{
+		return;
+	}
+
+	compare_flag = 0;
+
+#if LCD_USE_WRITE_QUEUE
+	in_isr = 1;
+	reg_value[HD_SREG] &= ~(1 << SREG_I);		//Interrupts are masked inside ISR
+	TIMER0_COMP_vect();
+	reg_value[HD_SREG] |= (1 << SREG_I);
+	in_isr = 0;
+#endif
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function advances simulated time, delivering timer interrupts which fall due
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	hd_advance
+*
+*   Parameters 		:  	uint64_t ns	-	Time to advance
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void hd_advance( uint64_t ns )
+{
+	uint64_t target = now_ns + ns, period;
+
+	if ( compare_flag )
+	{
+		hd_timer_interrupt();
+	}
+
+	period = hd_timer_period();
+
+	while ( ( period != 0 ) && ( compare_ns <= target ) )
+	{
+		if ( compare_ns > now_ns )
+		{
+			now_ns = compare_ns;
+		}
+		compare_ns += period;
+		compare_flag = 1;
+
+		hd_timer_interrupt();
+
+		if ( now_ns > target )
+		{
+			target = now_ns;		//ISR ran past the requested time
+		}
+		period = hd_timer_period();
+	}
+
+	now_ns = target;
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function returns simulated time since power on
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	hd_now
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	Time in ns
+*-------------------------------------------------------------------------------------------------------*/
+
+uint64_t hd_now(void)
+{
+	return now_ns;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function returns busy flag of HD44780
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	hd_busy
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	Non zero value while an instruction is executing
+*-------------------------------------------------------------------------------------------------------*/
+
+int hd_busy(void)
+{
+	return ( now_ns < hd.busy_until_ns );
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function returns DDRAM index of an address in current display mode
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	hd_ddram_index
+*
+*   Parameters 		:  	uint8_t addr	-	DDRAM address
+*
+*   Return     		: 	Index in ddram array
+*-------------------------------------------------------------------------------------------------------*/
+
+static int hd_ddram_index( uint8_t addr )
+{
+	if ( hd.two_line )
+	{
+		return ( ( addr & 0x40 ) ? HD_DDRAM_LINE_SIZE : 0 ) + ( addr & 0x3F ) % HD_DDRAM_LINE_SIZE;
+	}
+
+	return addr % HD_DDRAM_SIZE;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function moves address counter by one position in direction of entry mode
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	hd_step_address
+*
+*   Parameters 		:  	int increment	-	Non zero to increment address
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+static void hd_step_address( int increment )
+{
+	if ( hd.cgram_mode )
+	{
+		hd.ac = ( hd.ac + ( increment ? 1 : -1 ) ) & 0x3F;
+	}
+	else if ( hd.two_line )
+	{
+		//Line 1 ends at 0x27 and continues at 0x40, line 2 ends at 0x67 and wraps to 0x00
+		if ( increment )
+		{
+			hd.ac = ( hd.ac == 0x27 ) ? 0x40 : ( hd.ac == 0x67 ) ? 0x00 : hd.ac + 1;
+		}
+		else
+		{
+			hd.ac = ( hd.ac == 0x40 ) ? 0x27 : ( hd.ac == 0x00 ) ? 0x67 : hd.ac - 1;
+		}
+	}
+	else
+	{
+		hd.ac = ( hd.ac + ( increment ? 1 : HD_DDRAM_SIZE - 1 ) ) % HD_DDRAM_SIZE;
+	}
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function shifts whole display by one character
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	hd_shift_display
+*
+*   Parameters 		:  	int left	-	Non zero when content moves left
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+static void hd_shift_display( int left )
+{
+	int size = hd.two_line ? HD_DDRAM_LINE_SIZE : HD_DDRAM_SIZE;
+
+	hd.shift = ( hd.shift + ( left ? 1 : size - 1 ) ) % size;
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function executes an instruction or data write latched by HD44780
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	hd_execute
+*
+*   Parameters 		:  	uint8_t byte	-	Instruction or data
+*						int rs			-	Level of RS line
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+static void hd_execute( uint8_t byte, int rs )
+{
+	uint64_t exec_ns = HD_EXEC_NS;
+
+	//Controller does not accept anything while busy
+	if ( hd_busy() )
+	{
+		stats.busy_writes++;
+		return;
+	}
+
+	if ( rs )
+	{
+		stats.data++;
+		exec_ns = HD_DATA_EXEC_NS;
+
+		if ( hd.cgram_mode )
+		{
+			hd.cgram[hd.ac & 0x3F] = byte;
+		}
+		else
+		{
+			hd.ddram[hd_ddram_index( hd.ac )] = byte;
+			if ( hd.shift_entry )
+			{
+				hd_shift_display( hd.increment );
+			}
+		}
+		hd_step_address( hd.increment );
+	}
+	else
+	{
+		stats.commands++;
+
+		if ( byte & 0x80 )							//Set DDRAM address
+		{
+			hd.cgram_mode = 0;
+			hd.ac = byte & 0x7F;
+		}
+		else if ( byte & 0x40 )						//Set CGRAM address
+		{
+			hd.cgram_mode = 1;
+			hd.ac = byte & 0x3F;
+		}
+		else if ( byte & 0x20 )						//Function set
+		{
+			hd.eight_bit = ( byte & 0x10 ) != 0;
+			hd.two_line = ( byte & 0x08 ) != 0;
+			hd.nibble_pending = 0;
+		}
+		else if ( byte & 0x10 )						//Cursor or display shift
+		{
+			if ( byte & 0x08 )
+			{
+				hd_shift_display( ( byte & 0x04 ) == 0 );
+			}
+			else
+			{
+				hd_step_address( ( byte & 0x04 ) != 0 );
+			}
+		}
+		else if ( byte & 0x08 )						//Display control
+		{
+		}
+		else if ( byte & 0x04 )						//Entry mode set
+		{
+			hd.increment = ( byte & 0x02 ) != 0;
+			hd.shift_entry = ( byte & 0x01 ) != 0;
+		}
+		else if ( byte & 0x02 )						//Return home
+		{
+			hd.cgram_mode = 0;
+			hd.ac = 0;
+			hd.shift = 0;
+			exec_ns = HD_SLOW_EXEC_NS;
+		}
+		else if ( byte & 0x01 )						//Clear display
+		{
+			memset( hd.ddram, ' ', sizeof( hd.ddram ) );
+			hd.cgram_mode = 0;
+			hd.ac = 0;
+			hd.shift = 0;
+			hd.increment = 1;
+			exec_ns = HD_SLOW_EXEC_NS;
+		}
+	}
+
+	hd.busy_until_ns = now_ns + exec_ns;
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function returns bits present on data lines connected to HD44780 ( DB7 - DB0 )
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	hd_data_lines
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	Data byte, unconnected DB3 - DB0 read as 0 in 4 bit wiring
+*-------------------------------------------------------------------------------------------------------*/
+
+static uint8_t hd_data_lines(void)
+{
+#if LCD_BUS_WIDTH == 4
+	return ( ( LCD_DATA_PORT.raw() & LCD_DATA_MASK ) >> LCD_DATA_SHIFT ) << 4;
+#else
+	return LCD_DATA_PORT.raw();
+#endif
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function decodes a write to control port of LCD
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	hd_control_write
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+static void hd_control_write(void)
+{
+	uint8_t ctrl = LCD_CTRL_PORT.raw(), bits;
+	int enable = ( ctrl >> EN ) & 0x01;
+	int rs = ( ctrl >> RS ) & 0x01;
+	int rw = ( ctrl >> RW ) & 0x01;
+
+	if ( enable == hd.enable )
+	{
+		return;
+	}
+	hd.enable = enable;
+
+	if ( enable )
+	{
+		if ( now_ns - hd.enable_rise_ns < HD_ENABLE_CYCLE_NS )
+		{
+			stats.timing_errors++;
+		}
+		hd.enable_rise_ns = now_ns;
+
+		if ( rw && !rs && hd.read_phase == 0 )
+		{
+			stats.busy_reads++;
+		}
+
+		//LCD drives the data lines during a read, AVR pins must not be outputs
+		if ( rw && ( LCD_DATA_DDR.raw() & LCD_DATA_MASK ) )
+		{
+			stats.timing_errors++;
+		}
+		return;
+	}
+
+	//Falling edge of EN latches the bus
+	if ( now_ns - hd.enable_rise_ns < HD_ENABLE_PULSE_NS )
+	{
+		stats.timing_errors++;
+	}
+
+	if ( rw )
+	{
+		if ( !hd.eight_bit )
+		{
+			hd.read_phase ^= 1;
+		}
+		return;
+	}
+
+	bits = hd_data_lines();
+
+	if ( hd.eight_bit )
+	{
+		hd_execute( bits, rs );
+	}
+	else if ( !hd.nibble_pending )
+	{
+		hd.nibble_high = bits & 0xF0;
+		hd.nibble_pending = 1;
+	}
+	else
+	{
+		hd.nibble_pending = 0;
+		hd_execute( hd.nibble_high | ( bits >> 4 ), rs );
+	}
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function returns level of data port pins, LCD drives them while EN is high in read mode
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	hd_pin_read
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	PIN register value
+*-------------------------------------------------------------------------------------------------------*/
+
+static uint8_t hd_pin_read(void)
+{
+	uint8_t ctrl = LCD_CTRL_PORT.raw(), port = LCD_DATA_PORT.raw(), status;
+
+	if ( !hd.enable || ( ( ctrl >> RW ) & 0x01 ) == 0 || ( ( ctrl >> RS ) & 0x01 ) )
+	{
+		return port;
+	}
+
+	status = ( hd_busy() ? 0x80 : 0x00 ) | ( hd.ac & 0x7F );
+
+#if LCD_BUS_WIDTH == 4
+	if ( !hd.eight_bit && hd.read_phase )
+	{
+		status <<= 4;			//Low nibble is clocked out on second enable pulse
+	}
+	return ( port & ~LCD_DATA_MASK ) | ( ( ( status >> 4 ) << LCD_DATA_SHIFT ) & LCD_DATA_MASK );
+#else
+	return status;
+#endif
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Functions of I/O registers seen by LCD library
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	HD_reg
+*
+*   Parameters 		:  	uint8_t value	-	Value written to register
+*
+*   Return     		: 	Register value
+*-------------------------------------------------------------------------------------------------------*/
+
+HD_reg::operator uint8_t() const
+{
+	hd_advance( HD_REG_ACCESS_NS );
+
+	if ( this == &LCD_DATA_PIN )
+	{
+		return hd_pin_read();
+	}
+
+	return reg_value[id];
+}
+
+HD_reg& HD_reg::operator=( uint8_t value )
+{
+	reg_value[id] = value;
+
+	if ( this == &LCD_CTRL_PORT )
+	{
+		hd_control_write();
+	}
+	else if ( this == &TCCR0 )
+	{
+		compare_ns = now_ns + hd_timer_period();		//Timer restarts counting from bottom
+	}
+
+	hd_advance( HD_REG_ACCESS_NS );
+
+	return *this;
+}
+
+uint8_t HD_reg::raw(void) const
+{
+	return reg_value[id];
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function powers on HD44780 and clears all registers
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	hd_reset
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void hd_reset(void)
+{
+	memset( reg_value, 0, sizeof( reg_value ) );
+	memset( &hd, 0, sizeof( hd ) );
+	memset( &stats, 0, sizeof( stats ) );
+
+	now_ns = 0;
+	compare_ns = 0;
+	compare_flag = 0;
+	in_isr = 0;
+
+	//Internal reset clears display, selects 8 bit interface and increments address
+	memset( hd.ddram, ' ', sizeof( hd.ddram ) );
+	hd.eight_bit = 1;
+	hd.increment = 1;
+	hd.busy_until_ns = HD_RESET_NS;
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function starts measuring a frame
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	hd_frame_begin
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void hd_frame_begin(void)
+{
+	memset( &stats, 0, sizeof( stats ) );
+	stats.start_ns = now_ns;
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function records time at which frame code returned to caller
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	hd_frame_cpu_done
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void hd_frame_cpu_done(void)
+{
+	stats.cpu_ns = now_ns;
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function runs until LCD and write queue are idle and returns statistics of frame
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	hd_frame_end
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	Frame statistics
+*-------------------------------------------------------------------------------------------------------*/
+
+HD_stats hd_frame_end(void)
+{
+	if ( stats.cpu_ns == 0 )
+	{
+		stats.cpu_ns = now_ns;
+	}
+
+	//Queued writes are still being sent by timer interrupt
+	while ( ( reg_value[HD_TIMSK] & (1 << OCIE0) ) && hd_timer_period() != 0 )
+	{
+		hd_advance( HD_EXEC_NS );
+	}
+
+	if ( stats.commands + stats.data > 0 )
+	{
+		stats.idle_ns = hd.busy_until_ns;
+	}
+	else
+	{
+		stats.idle_ns = stats.start_ns;
+	}
+
+	if ( now_ns < hd.busy_until_ns )
+	{
+		hd_advance( hd.busy_until_ns - now_ns );
+	}
+
+	return stats;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function returns characters visible on a line of display, taking display shift into account
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	hd_visible_line
+*
+*   Parameters 		:  	int row		-	Row counted from 0
+*						char *text	-	Receives LCD_COLUMNS characters and NUL
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void hd_visible_line( int row, char *text )
+{
+	int column, size, base, line;
+
+	size = hd.two_line ? HD_DDRAM_LINE_SIZE : HD_DDRAM_SIZE;
+	line = hd.two_line ? ( row & 0x01 ) : 0;
+	base = hd.two_line ? ( row >> 1 ) * LCD_COLUMNS : row * LCD_COLUMNS;
+
+	for (column = 0; column < LCD_COLUMNS; column += 1)
+	{
+		text[column] = hd.ddram[line * HD_DDRAM_LINE_SIZE + ( base + column + hd.shift ) % size];
+	}
+	text[LCD_COLUMNS] = '\0';
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function returns a byte of CGRAM
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	hd_cgram
+*
+*   Parameters 		:  	int addr	-	CGRAM address
+*
+*   Return     		: 	CGRAM byte
+*-------------------------------------------------------------------------------------------------------*/
+
+uint8_t hd_cgram( int addr )
+{
+	return hd.cgram[addr & 0x3F];
+}
+
+/*********************************************************************************************************/
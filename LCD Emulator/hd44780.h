@@ -0,0 +1,89 @@
+#ifndef HD44780_H
+#define HD44780_H
+
+/*********************************************************************************************************
+											 HEADER FILES
+*********************************************************************************************************/
+
+#include <stdint.h>
+
+/*********************************************************************************************************
+									  	   MACRO DEFINITIONS
+*********************************************************************************************************/
+
+//Execution times of HD44780 at 270kHz oscillator ( in ns )
+#define HD_EXEC_NS				37000UL
+#define HD_SLOW_EXEC_NS			1520000UL		//Clear screen and return home
+#define HD_DATA_EXEC_NS			41000UL			//Write to RAM includes 4us address counter update
+#define HD_RESET_NS				10000000UL		//Internal reset after power on, busy flag stays high
+
+//Bus timing of HD44780 ( in ns )
+#define HD_ENABLE_PULSE_NS		450				//Minimum enable high time
+#define HD_ENABLE_CYCLE_NS		1000			//Minimum time between two enable rising edges
+
+#define HD_CPU_CYCLE_NS			( 1000000000UL / F_CPU )
+#define HD_REG_ACCESS_NS		HD_CPU_CYCLE_NS	//Each I/O register read or write costs one CPU cycle
+
+#define HD_DDRAM_SIZE			80
+#define HD_DDRAM_LINE_SIZE		40
+#define HD_CGRAM_SIZE			64
+
+/*******************************************************************************************************
+										 STRUCTURE DEFINITION
+*******************************************************************************************************/
+
+//Bus activity counters, cleared at start of every frame
+typedef struct
+{
+	uint64_t start_ns;				//Simulated time at start of frame
+	uint64_t cpu_ns;				//Time at which frame code returned to caller
+	uint64_t idle_ns;				//Time at which LCD finished last instruction of frame
+	unsigned long commands;			//Instructions latched by LCD
+	unsigned long data;				//Data bytes latched by LCD
+	unsigned long busy_reads;		//Busy flag reads
+	unsigned long busy_writes;		//Instructions or data written while LCD was busy
+	unsigned long timing_errors;	//Enable pulses shorter than HD44780 bus timing allows
+}HD_stats;
+
+/*	I/O register seen by LCD driver. Every read and write is routed to the
+ *	HD44780 model, so edges on control lines are observed exactly as the
+ *	driver produces them.														*/
+class HD_reg
+{
+public:
+	explicit HD_reg( int id ) : id( id ) {}
+
+	operator uint8_t() const;
+	HD_reg& operator=( uint8_t value );
+	HD_reg& operator|=( uint8_t value ) { return *this = (uint8_t)( *this | value ); }
+	HD_reg& operator&=( uint8_t value ) { return *this = (uint8_t)( *this & value ); }
+	HD_reg& operator^=( uint8_t value ) { return *this = (uint8_t)( *this ^ value ); }
+
+	uint8_t raw(void) const;				//Value without bus side effects or time cost
+
+	HD_reg( const HD_reg& ) = delete;
+	HD_reg& operator=( const HD_reg& ) = delete;
+
+private:
+	int id;
+};
+
+/*******************************************************************************************************
+										  FUNCTION PROTOTYPES
+*******************************************************************************************************/
+
+void hd_reset(void);
+void hd_advance(uint64_t);
+uint64_t hd_now(void);
+int hd_busy(void);
+
+void hd_frame_begin(void);
+void hd_frame_cpu_done(void);
+HD_stats hd_frame_end(void);
+
+void hd_visible_line(int, char*);
+uint8_t hd_cgram(int);
+
+/*********************************************************************************************************/
+
+#endif
@@ -0,0 +1,42 @@
+/*********************************************************************************************************
+								 LCD LIBRARY CONFIGURATION ( HD44780 Emulator )
+*********************************************************************************************************/
+#ifndef LCD_CONFIG_H
+#define LCD_CONFIG_H
+
+/*	Defaults match the Super Mario Game wiring. Every option can be overridden
+ *	on the compiler command line, e.g. -DLCD_BUS_WIDTH=4 -DLCD_USE_WRITE_QUEUE=0,
+ *	to benchmark the configuration used by another project.					*/
+
+#define F_CPU	8000000UL	//Setting clock at 8MHz
+
+#ifndef LCD_BUS_WIDTH
+#define LCD_BUS_WIDTH		8
+#endif
+
+#ifndef LCD_COLUMNS
+#define LCD_COLUMNS			16
+#endif
+
+#ifndef LCD_LINES
+#define LCD_LINES			2
+#endif
+
+#ifndef LCD_USE_BUSY_FLAG
+#define LCD_USE_BUSY_FLAG	1
+#endif
+
+#ifndef LCD_USE_WRITE_QUEUE
+#define LCD_USE_WRITE_QUEUE	1
+#endif
+
+/*	Bus hooks count every use of the data lines, like the Real Time Clock hook which turns
+ *	a 7segment digit off and on. bench.cpp fails a frame that leaves them unbalanced.	*/
+extern unsigned long bench_bus_acquired, bench_bus_released;
+
+#define LCD_BUS_ACQUIRE(state)	do { state = 1; bench_bus_acquired += 1; } while (0)
+#define LCD_BUS_RELEASE(state)	do { bench_bus_released += state; } while (0)
+
+#endif
+
+/*********************************************************************************************************/
@@ -0,0 +1,22 @@
+/*********************************************************************************************************
+					   HOST REPLACEMENT OF <util/delay.h> FOR THE HD44780 EMULATOR
+*********************************************************************************************************/
+#ifndef HD_UTIL_DELAY_H
+#define HD_UTIL_DELAY_H
+
+#include "../hd44780.h"
+
+//Busy wait delays advance simulated time instead of spinning
+static inline void _delay_us( double us )
+{
+	hd_advance( (uint64_t)( us * 1000.0 ) );
+}
+
+static inline void _delay_ms( double ms )
+{
+	hd_advance( (uint64_t)( ms * 1000000.0 ) );
+}
+
+#endif
+
+/*********************************************************************************************************/
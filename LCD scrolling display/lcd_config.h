@@ -0,0 +1,34 @@
+/*********************************************************************************************************
+								   LCD LIBRARY CONFIGURATION ( LCD scrolling display )
+*********************************************************************************************************/
+#ifndef LCD_CONFIG_H
+#define LCD_CONFIG_H
+
+#define F_CPU	8000000UL	//Setting clock at 8MHz
+
+//Control pins
+#define LCD_CTRL_PORT		PORTD
+#define LCD_CTRL_DDR		DDRD
+#define RS					PD4
+#define RW					PD5
+#define EN					PD6
+
+//Data lines on PORTB
+#define LCD_DATA_PORT		PORTB
+#define LCD_DATA_DDR		DDRB
+#define LCD_DATA_PIN		PINB
+
+//All eight data lines are connected
+#define LCD_BUS_WIDTH		8
+
+//16x2 display
+#define LCD_COLUMNS			16
+#define LCD_LINES			2
+
+//Timing strategy
+#define LCD_USE_BUSY_FLAG	1
+#define LCD_USE_WRITE_QUEUE	0
+
+#endif
+
+/*********************************************************************************************************/
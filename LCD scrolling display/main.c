@@ -11,6 +11,7 @@
 
 #include "main.h"
 #include "lcd.h"
+#include "sched.h"
 
 /*******************************************************************************************************
 					   MAIN FUNCTION										
@@ -22,7 +23,14 @@ int main(void)
 	DDRD = LCD_CTRL_ENABLE;		//RS, RW, and EN set as output
 	lcd_init();	
 
-	lcd_scroll("HELLO WORLD");
+	lcd_scroll_load( "HELLO WORLD", LINE1 );		//String is written to DDRAM only once
+
+	clock_init();
+	sched_init();
+	sched_add( scroll_task, SCROLL_PERIOD, 0 );
+	sei();
+
+	sched_run();
 
 	return EXIT_SUCCESS;
 }
@@ -32,63 +40,20 @@ int main(void)
 *******************************************************************************************************/
 
 /*--------------------------------------------------------------------------------------------------------
-	Function generates time delay with given user time ( in ms )
+	Function moves scrolled string by one position
 ----------------------------------------------------------------------------------------------------------
 *   
-*   Function Name : timer1_delay_ms
+*   Function Name 	: 	scroll_task
 *
-*   Parameters : long int delay_ms	-	Delay to generate ( in ms )
+*   Parameters 		:  	NONE
 *
-*   Return     : NONE
+*   Return     		: 	NONE
 *-------------------------------------------------------------------------------------------------------*/
 
-void timer1_delay_ms(long int delay_ms)
+void scroll_task(void)
 {
-	/*	We are setting prescalar as 1024
-	 *	so clock value for timer will be Fosc / 1024 = 7812.5Hz ( Fosc = 8MHz )
-	 *	time taken for one cycle = 1 / 7812.5 = 0.128 ms
-	 *	
-	 *	=> TCNT value = ( delay_ms / 0.128ms )	*/ 
-
-	long int tcnt_value;
-
-	tcnt_value = TCNT1_MAX - ( delay_ms / ONE_COUNT_TIME_1024 );	
-
-	TCNT1H = ( (tcnt_value & ( 0xFF00 )) >> 8 );	
-	TCNT1L = ( tcnt_value & ( 0x00FF ) );	 	
-							
-	TCCR1A = CLEAR_ALL;
-	TCCR1B |= SET_PRESCALAR_1024;
-
-	while( ( TIFR & ( 1 << TOV1 ) ) == 0 );		//Waiting until overflow occurs
-
-	TCCR1B = CLEAR_ALL;
-	TIFR = ( 1 << TOV1 );
-
+	lcd_scroll_step( SCROLL_RIGHT );
 	return;
 }
 
-/*--------------------------------------------------------------------------------------------------------
-	Function returns size of string
-----------------------------------------------------------------------------------------------------------
-*   
-*   Function Name 	: 	string_count
-*
-*   Parameters 		:  	char *str	- 	Input string
-*
-*   Return     		: 	size of string
-*-------------------------------------------------------------------------------------------------------*/
-
-int string_count(char *str)
-{
-	int size = 0;
-
- 	while ( *(str + size) != NULL_CHAR )
-  	{	
-   		size++;
-  	}
- 
- 	return size;
-}
-
 /******************************************************************************************************/
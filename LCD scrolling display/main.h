@@ -18,13 +18,7 @@
 
 
 
-//Timer specific macros
-#define TCNT1_MAX				65535
-#define TCNT_MAX				255
-#define TCNT_MIN				0
-#define ONE_COUNT_TIME_1024		0.128
-#define SET_PRESCALAR_1024		( 1 << CS00 ) | ( 1 << CS02 )
-#define STOP_TIMER				0x00
+#define SCROLL_PERIOD			300			//Time between scroll steps ( in ms )
 
 #define INCREMENT(x)	x++
 #define DECREMENT(x)	x--
@@ -33,16 +27,8 @@
 										  FUNCTION PROTOTYPES 					
 *******************************************************************************************************/
 
-void timer1_delay_ms(long int);
-int string_count(char*);
+void scroll_task(void);
 
-void lcd_init(void);
-void lcd_command(unsigned char);
-void lcd_data(unsigned char);
-void lcd_printf(char*, int, int);
-void lcd_scroll(char*);
-void lcd_set_cursor(int,int);
-void step_right( char* );
 void clear_data(void);
 
 /*********************************************************************************************************/
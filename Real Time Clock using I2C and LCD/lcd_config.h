@@ -0,0 +1,43 @@
+/*********************************************************************************************************
+								   LCD LIBRARY CONFIGURATION ( Real Time Clock )
+*********************************************************************************************************/
+#ifndef LCD_CONFIG_H
+#define LCD_CONFIG_H
+
+#define F_CPU	8000000UL	//Setting clock at 8MHz
+
+//Control pins
+#define LCD_CTRL_PORT		PORTD
+#define LCD_CTRL_DDR		DDRD
+#define RS					PD4
+#define RW					PD5
+#define EN					PD6
+
+//Data lines on PORTB
+#define LCD_DATA_PORT		PORTB
+#define LCD_DATA_DDR		DDRB
+#define LCD_DATA_PIN		PINB
+
+//Only DATA4 - DATA7 are connected, on PB4 - PB7
+#define LCD_BUS_WIDTH		4
+#define LCD_DATA_SHIFT		PB4
+
+//16x2 display
+#define LCD_COLUMNS			16
+#define LCD_LINES			2
+
+//Timing strategy
+#define LCD_USE_BUSY_FLAG	1
+#define LCD_USE_WRITE_QUEUE	1
+
+/*	Segments D - G of 7segment display are on PB4 - PB7 as well. Lit digit is turned off while LCD queue
+ *	drives or reads these pins, so LCD nibbles never show on it. All LCD writes after seg7_init have
+ *	to go through write queue for this.															*/
+#include "seg7.h"
+
+#define LCD_BUS_ACQUIRE(state)	do { state = SEG7_DIGIT_PORT & SEG7_DIGIT_MASK; SEG7_DIGIT_PORT &= ~SEG7_DIGIT_MASK; } while (0)
+#define LCD_BUS_RELEASE(state)	do { SEG7_DIGIT_PORT |= state; } while (0)
+
+#endif
+
+/*********************************************************************************************************/
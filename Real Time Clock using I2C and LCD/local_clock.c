@@ -0,0 +1,280 @@
+/*******************************************************************************************************
+*	Local clock
+*
+*	Time of day is kept in RAM and advanced by micros(), so it can be read at any time with 1ms
+*	resolution without touching the I2C bus. millis() steps by 2 or 3ms on each Timer2 overflow,
+*	so the clock counts its own milliseconds ( uptime ) from micros() instead.
+*
+*	It is resynchronised from the RTC, and the rate difference between Timer2 crystal and RTC is
+*	measured between syncs and corrected by adding or dropping 1ms every local_step ms.
+*
+*	Syncs taken on an SQW edge are exact to the millisecond, only they are used to measure drift.
+*
+********************************************************************************************************
+											 HEADER FILES
+*******************************************************************************************************/
+
+#include "main.h"
+
+/*******************************************************************************************************
+										    GLOBAL VARIABLES
+*******************************************************************************************************/
+
+uint32_t local_uptime = 0;				//Milliseconds counted from micros()
+uint32_t local_last_us = 0;				//micros() at last count
+uint16_t local_rem_us = 0;				//Microseconds not yet counted in local_uptime
+
+RTC_i2c local_date;						//Time and date of last sync, date is kept until next sync
+uint32_t local_sync_ms;					//Time of day at last sync ( in ms )
+uint32_t local_sync_at;					//Uptime at last sync
+uint8_t local_valid = 0;				//Set once clock was synced
+
+//Drift correction, clock gains ( local_step_sign > 0 ) or loses 1ms every local_step ms, 0 for none
+uint32_t local_step = 0;
+int8_t local_step_sign = 0;
+
+//Time measured by RTC and by uptime between exact syncs, their difference is the drift
+uint32_t local_rtc_total = 0, local_uptime_total = 0;
+uint32_t local_prev_ms, local_prev_at;	//Last exact sync
+uint8_t local_chain = 0;				//Set when last sync was exact
+
+int32_t local_error_ms = 0;				//RTC minus local clock at last sync, for statistics
+
+/*******************************************************************************************************
+										  FUNCTION DEFINITIONS
+*******************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------
+	Function returns milliseconds counted from micros(), it has to be called at least every 71 minutes
+----------------------------------------------------------------------------------------------------------
+*
+*   Function Name : local_clock_uptime
+*
+*   Parameters : NONE
+*
+*   Return     : Uptime ( in ms )
+*-------------------------------------------------------------------------------------------------------*/
+
+uint32_t local_clock_uptime(void)
+{
+	uint32_t now_us = micros();
+	uint32_t us = ( now_us - local_last_us ) + local_rem_us;
+
+	local_last_us = now_us;
+	local_uptime += us / 1000;
+	local_rem_us = us % 1000;
+
+	return local_uptime;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function converts a recent micros() timestamp to uptime
+----------------------------------------------------------------------------------------------------------
+*
+*   Function Name : local_clock_uptime_of
+*
+*   Parameters : uint32_t us	-	micros() value taken less than 71 minutes ago
+*
+*   Return     : Uptime at given timestamp ( in ms )
+*-------------------------------------------------------------------------------------------------------*/
+
+uint32_t local_clock_uptime_of( uint32_t us )
+{
+	uint32_t age;
+
+	local_clock_uptime();
+
+	age = local_last_us - us;
+
+	//Timestamp after last whole millisecond counted belongs to it
+	if ( age <= local_rem_us )
+	{
+		return local_uptime;
+	}
+
+	return local_uptime - ( age - local_rem_us + 999 ) / 1000;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function forgets sync and measured drift, used when time of RTC is changed
+----------------------------------------------------------------------------------------------------------
+*
+*   Function Name : local_clock_reset
+*
+*   Parameters : NONE
+*
+*   Return     : NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void local_clock_reset(void)
+{
+	local_valid = 0;
+	local_chain = 0;
+	local_step = 0;
+	local_step_sign = 0;
+	local_rtc_total = 0;
+	local_uptime_total = 0;
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function sets local clock to time read from RTC and updates drift correction
+----------------------------------------------------------------------------------------------------------
+*
+*   Function Name : local_clock_sync
+*
+*   Parameters : RTC_i2c time	-	Time and date read from RTC
+*				 uint32_t at	-	Uptime at which time was valid
+*				 int exact		-	1 when at is the SQW edge which started this second
+*
+*   Return     : NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void local_clock_sync( RTC_i2c time, uint32_t at, int exact )
+{
+	uint32_t rtc_ms, delta;
+	int32_t diff;
+
+	rtc_ms = ( bcd_to_dec( time.hours ) * 3600UL + bcd_to_dec( time.minutes ) * 60UL + bcd_to_dec( time.seconds ) ) * 1000UL;
+
+	if ( local_valid )
+	{
+		//Error is taken the short way round midnight
+		local_error_ms = (int32_t)( rtc_ms - local_clock_ms_at( at ) );
+		if ( local_error_ms > (int32_t)( MS_PER_DAY / 2 ) )
+		{
+			local_error_ms -= MS_PER_DAY;
+		}
+		else if ( local_error_ms < -(int32_t)( MS_PER_DAY / 2 ) )
+		{
+			local_error_ms += MS_PER_DAY;
+		}
+	}
+
+	if ( exact && local_chain )
+	{
+		delta = ( rtc_ms >= local_prev_ms ) ? rtc_ms - local_prev_ms : rtc_ms + MS_PER_DAY - local_prev_ms;
+
+		local_rtc_total += delta;
+		local_uptime_total += at - local_prev_at;
+
+		//Halving both keeps their ratio and room for further syncs
+		if ( local_uptime_total > LOCAL_TOTAL_MAX )
+		{
+			local_rtc_total /= 2;
+			local_uptime_total /= 2;
+		}
+
+		diff = (int32_t)( local_rtc_total - local_uptime_total );
+
+		if ( diff == 0 )
+		{
+			local_step = 0;
+			local_step_sign = 0;
+		}
+		else
+		{
+			local_step_sign = ( diff > 0 ) ? 1 : -1;
+			local_step = local_uptime_total / ( ( diff > 0 ) ? diff : -diff );
+		}
+	}
+
+	//Only a chain of exact syncs measures drift
+	local_chain = exact;
+	local_prev_ms = rtc_ms;
+	local_prev_at = at;
+
+	local_date = time;
+	local_sync_ms = rtc_ms;
+	local_sync_at = at;
+	local_valid = 1;
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function returns 1 once local clock has been synced
+----------------------------------------------------------------------------------------------------------
+*
+*   Function Name : local_clock_valid
+*
+*   Parameters : NONE
+*
+*   Return     : 1 or 0
+*-------------------------------------------------------------------------------------------------------*/
+
+int local_clock_valid(void)
+{
+	return local_valid;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function returns time of day of local clock at given uptime
+----------------------------------------------------------------------------------------------------------
+*
+*   Function Name : local_clock_ms_at
+*
+*   Parameters : uint32_t at	-	Uptime, not before last sync
+*
+*   Return     : Time of day ( in ms )
+*-------------------------------------------------------------------------------------------------------*/
+
+uint32_t local_clock_ms_at( uint32_t at )
+{
+	uint32_t elapsed = at - local_sync_at;
+	uint32_t correction = ( local_step != 0 ) ? elapsed / local_step : 0;
+
+	if ( local_step_sign < 0 )
+	{
+		elapsed -= correction;
+	}
+	else
+	{
+		elapsed += correction;
+	}
+
+	return ( local_sync_ms + elapsed ) % MS_PER_DAY;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function returns current time of day of local clock
+----------------------------------------------------------------------------------------------------------
+*
+*   Function Name : local_clock_ms
+*
+*   Parameters : NONE
+*
+*   Return     : Time of day ( in ms )
+*-------------------------------------------------------------------------------------------------------*/
+
+uint32_t local_clock_ms(void)
+{
+	return local_clock_ms_at( local_clock_uptime() );
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function fills RTC structure from local clock, date is the one of last sync
+----------------------------------------------------------------------------------------------------------
+*
+*   Function Name : local_clock_time
+*
+*   Parameters : RTC_i2c *time	-	structure to receive time and date
+*
+*   Return     : NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void local_clock_time( RTC_i2c *time )
+{
+	uint32_t seconds = local_clock_ms() / 1000;
+
+	*time = local_date;
+
+	time->hours = dec_to_bcd( seconds / 3600 );
+	time->minutes = dec_to_bcd( ( seconds / 60 ) % 60 );
+	time->seconds = dec_to_bcd( seconds % 60 );
+
+	return;
+}
+
+/*********************************************************************************************************/
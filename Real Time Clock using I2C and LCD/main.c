@@ -0,0 +1,547 @@
+/*******************************************************************************************************
+*   TASK :
+*	
+*	1.	Display RTC using I2C communication.
+*	2.	Use LCD for displaying date and time
+*	3.	Use hardware ( TWI ) or software ( bit bang ) implementation of I2C, chosen by I2C_BACKEND
+*
+*	Date :	10/11/2021	09:15:00 AM
+*
+*
+*	PIN CONFIGURATIONS :
+*
+*	LCD pins :
+*
+*	PB0	-	DATA0
+*	PB1	-	DATA1
+*	PB2	-	DATA2
+*	PB3	-	DATA3
+*	PB4	-	DATA4
+*	PB5	-	DATA5
+*	PB6	-	DATA6
+*	PB7	-	DATA7
+*
+*	In 4 bit mode ( LCD_BUS_WIDTH in lcd_config.h ) only PB4 - PB7 are used by LCD
+*
+*	PD4	-	RS pin
+*	PD5	-	RW pin
+*	PD6	-	EN pin
+*
+*	PD3	-	SQW/OUT pin of RTC ( INT1 ), in place of buzzer
+*
+*	I2C pins :
+*
+*	PC1	-	SDA pin ( TWI )
+*	PC0	-	SCL pin ( TWI )
+*	PD1	-	SDA pin ( bit bang, I2C_BB_SDA in i2c.h )
+*	PD0	-	SCL pin ( bit bang, I2C_BB_SCL in i2c.h )
+*
+*	INT0 button is used for time reset
+*	INT1 receives 1Hz square wave of RTC, local clock is synced with RTC on a falling edge
+*
+********************************************************************************************************
+											 HEADER FILES										
+*******************************************************************************************************/
+
+#include "main.h"
+
+/*******************************************************************************************************
+									   GLOBAL VARIABLES AND ISRs									
+*******************************************************************************************************/
+
+RTC_i2c rtc;
+
+volatile int set_time_request = 0;		//Set by INT0 button, handled by RTC task
+
+int seg_minute = -1, seg_hour = -1;		//Time shown in 7segment display, none before first RTC read
+
+unsigned int rtc_failures = 0;			//RTC transfers which failed
+
+uint8_t rtc_sqw_on = 0;					//Set once SQW output of RTC has been enabled
+uint32_t rtc_sqw_tried;					//millis() when SQW output was last tried
+
+//RTC read is carried out by TWI interrupt while other tasks run, bit bang completes it when submitted
+const uint8_t rtc_reg = RTC_SECONDS;			//Register address sent before reading time
+RTC_i2c rtc_raw;								//Registers received by last read
+volatile uint8_t rtc_fresh = 0;					//Set when a read has ended
+volatile uint8_t rtc_second = 0;				//Set on every SQW edge
+volatile uint32_t rtc_edge_ms;					//millis() at last SQW edge, for SQW timeout
+volatile uint32_t rtc_edge_us;					//micros() at last SQW edge, for local clock sync
+uint32_t rtc_last_read;							//millis() when last read was submitted
+uint32_t rtc_read_at;							//Local clock uptime at which time of last read was valid
+uint8_t rtc_read_exact;							//Set when last read was started by SQW edge
+uint8_t rtc_resync = 1;							//Set when local clock has to be synced before RTC_RESYNC_PERIOD
+
+int32_t rtc_shown_second = -1;					//Second of day shown in displays
+
+RTC_i2c lcd_shown;								//Time and date last shown in LCD
+uint8_t lcd_shown_valid = 0;					//Cleared until LCD shows a time
+
+const char lcd_days[][4] = { "NIL", "MON", "TUE", "WED", "THU", "FRI", "SAT", "SUN" };
+
+I2C_xfer rtc_read = { RTC_WRITE_ADDR, &rtc_reg, 1, (uint8_t*)&rtc_raw, sizeof(RTC_i2c), RTC_read_done, I2C_IDLE };
+
+ISR( INT0_vect )
+{
+	set_time_request = 1;
+}
+
+//Seconds register of RTC has just advanced
+ISR( INT1_vect )
+{
+	rtc_edge_ms = millis();
+	rtc_edge_us = micros();
+	rtc_second = 1;
+}
+
+/*******************************************************************************************************
+											 MAIN FUNCTION										
+*******************************************************************************************************/
+
+int main(void)
+{
+	initialize_modules();		//Initializes GPIO pins, button, 7segment, lcd and I2C interface
+
+	sched_add( rtc_task, RTC_POLL_PERIOD, 0 );
+	sched_add( i2c_watchdog, I2C_TIMEOUT_MS, 0 );
+
+	sched_run();
+
+	return EXIT_SUCCESS;
+}
+
+/*******************************************************************************************************
+										  FUNCTION DEFINITIONS 					
+*******************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------
+	Function performs I2C initializations
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	I2C_init
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void initialize_modules(void)
+{ 
+	//GPIO configurations
+	DDRB = SET_ALL ;					//Configuring LCD data lines as output
+	DDRD = LCD_CTRL_ENABLE;				//RS, RW, and EN set as output
+	PORTD |= (1 << PD3);				//Pull up for open drain SQW/OUT of RTC
+
+	//Interrupt enabling for INT0 and INT1
+
+	GICR = INT0_ENABLE | INT1_ENABLE ;
+	MCUCR = INT0_RISING_EDGE_TRIG | INT1_FALLING_EDGE_TRIG ;
+	sei();							//Enabling global interrupt
+
+
+	//LCD configuration
+	lcd_init();
+	lcd_buffer_init();				//Time fields are redrawn through shadow buffer
+	lcd_set_cursor(0,2);
+	lcd_puts_P( PSTR("Date - ") );
+
+	//I2C configuration
+	I2C_init();
+
+	clock_init();					//Starting millis() and micros() time base on Timer2
+	sched_init();					//Starting 1ms scheduler tick on Timer1
+	seg7_init();					//Scanning 7segment display from Timer1 compare B interrupt
+
+	//RTC may not answer yet at power up, RTC task then retries
+	rtc_sqw_on = ( RTC_sqw_init() == PASS );
+	rtc_sqw_tried = millis();
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function keeps local clock synced with RTC, shows its time and sets RTC time when INT0 button was pressed
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	rtc_task
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void rtc_task(void)
+{
+	uint32_t now, edge_ms, edge_us;
+	int32_t second;
+	uint8_t sreg, edge;
+
+	if ( set_time_request )
+	{
+		set_time_request = 0;
+
+		if ( RTC_set_time(rtc) == FAIL )
+		{
+			rtc_failures++;
+		}
+
+		//Drift measured against old time no longer holds
+		local_clock_reset();
+		rtc_resync = 1;
+	}
+
+	//Without square wave local clock is only synced by reads made after RTC_SQW_TIMEOUT
+	if ( !rtc_sqw_on && ( millis() - rtc_sqw_tried >= RTC_SQW_RETRY ) )
+	{
+		rtc_sqw_tried = millis();
+
+		if ( RTC_sqw_init() == PASS )
+		{
+			rtc_sqw_on = 1;
+		}
+		else
+		{
+			rtc_failures++;
+		}
+	}
+
+	//Result of read started in earlier run corrects local clock
+	if ( rtc_fresh )
+	{
+		rtc_fresh = 0;
+
+		if ( RTC_get_time(&rtc) == FAIL )
+		{
+			rtc_failures++;
+			rtc_resync = 1;
+
+			//Local clock keeps running once it has been synced
+			if ( !local_clock_valid() )
+			{
+				seg7_puts("Err");
+				seg_minute = -1;				//Time is redrawn once RTC answers
+			}
+		}
+		else
+		{
+			local_clock_sync( rtc, rtc_read_at, rtc_read_exact );
+			rtc_shown_second = -1;
+		}
+	}
+
+	now = millis();
+	local_clock_uptime();				//Counted often enough for micros() not to wrap unseen
+
+	sreg = SREG;
+	cli();								//Edge flag and 32 bit edge time are written together by INT1
+	edge_ms = rtc_edge_ms;
+	edge_us = rtc_edge_us;
+	edge = rtc_second;
+	rtc_second = 0;
+	SREG = sreg;
+
+	//RTC is read on first SQW edge once a sync is due, or without edge when square wave is missing
+	if ( rtc_resync || ( now - rtc_last_read >= RTC_RESYNC_PERIOD ) )
+	{
+		if ( edge || ( now - edge_ms > RTC_SQW_TIMEOUT ) )
+		{
+			//Bus transfer runs while other tasks are dispatched, a read still on the bus is left to end
+			if ( i2c_submit( &rtc_read ) == PASS )
+			{
+				rtc_read_exact = edge;
+				rtc_read_at = edge ? local_clock_uptime_of( edge_us ) : local_clock_uptime();
+				rtc_last_read = now;
+				rtc_resync = 0;
+			}
+		}
+	}
+
+	//Displays follow local clock and are redrawn once per second
+	if ( local_clock_valid() )
+	{
+		second = local_clock_ms() / 1000;
+
+		if ( second != rtc_shown_second )
+		{
+			//Date changes at midnight, it is read again from RTC
+			if ( second < rtc_shown_second )
+			{
+				rtc_resync = 1;
+			}
+
+			rtc_shown_second = second;
+
+			local_clock_time( &rtc );
+			time_display( rtc );
+			lcd_time_display( rtc );
+		}
+	}
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function sets initial values for RTC registers
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name : RTC_init
+*
+*   Parameters : RTC_i2c *rtc	-	structure containing time and date
+*
+*   Return     : NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void RTC_init( RTC_i2c *rtc )
+{
+	rtc->seconds = SECONDS_INIT ;
+	rtc->minutes = MINUTES_INIT ;
+	rtc->hours = HOURS_INIT ;
+	rtc->day = DAY_INIT ;
+	rtc->date = DATE_INIT ;
+	rtc->month = MONTH_INIT ;
+	rtc->year = YEAR_INIT ;
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function sets initial time in RTC
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name : RTC_set_time
+*
+*   Parameters : RTC_i2c rtc	-	structure containing time and date
+*
+*   Return     : PASS or FAIL
+*-------------------------------------------------------------------------------------------------------*/
+
+int RTC_set_time( RTC_i2c rtc )
+{
+	RTC_init(&rtc);		//Initializing values for storing in RTC registers 
+
+	//Structure follows register order, so time is written in one burst
+	return i2c_write_regs( RTC_WRITE_ADDR, RTC_SECONDS, (uint8_t*)&rtc, sizeof(RTC_i2c) );
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function enables 1Hz square wave on SQW/OUT pin of RTC
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name : RTC_sqw_init
+*
+*   Parameters : NONE
+*
+*   Return     : PASS or FAIL
+*-------------------------------------------------------------------------------------------------------*/
+
+int RTC_sqw_init(void)
+{
+	const uint8_t control = RTC_SQW_1HZ;
+
+	return i2c_write_regs( RTC_WRITE_ADDR, RTC_CONTROL, &control, 1 );
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function gets date and time received by last read of RTC registers
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name : RTC_get_time
+*
+*   Parameters : RTC_i2c *rtc	-	structure to receive time and date
+*
+*   Return     : PASS or FAIL when last read failed
+*-------------------------------------------------------------------------------------------------------*/
+
+int RTC_get_time(RTC_i2c *rtc)
+{
+	if ( rtc_read.status != I2C_DONE )
+	{
+		return FAIL;
+	}
+
+	*rtc = rtc_raw;
+
+	return PASS;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function is called when read of RTC registers ends, from TWI interrupt on TWI backend
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name : RTC_read_done
+*
+*   Parameters : I2C_xfer *xfer	-	Ended transaction
+*
+*   Return     : NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void RTC_read_done( I2C_xfer *xfer )
+{
+	(void)xfer;						//Only one read is ever submitted
+	rtc_fresh = 1;
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function updates time shown in seven segment display
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name : time_display
+*
+*   Parameters 	  : RTC_i2c rtc	-	structure to receive time and date
+*
+*   Return     	  :	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void time_display( RTC_i2c rtc )
+{
+	int mins, hrs;
+
+	mins = bcd_to_dec( rtc.minutes );
+	hrs = bcd_to_dec( rtc.hours );
+
+	//Segment patterns are worked out only when the minute changes, scan interrupt just copies them
+	if ( ( mins == seg_minute ) && ( hrs == seg_hour ) )
+	{
+		return;
+	}
+
+	//Display is dimmed at night, refresh rate stays the same
+	if ( hrs != seg_hour )
+	{
+		if ( ( hrs >= NIGHT_START_HOUR ) || ( hrs < NIGHT_END_HOUR ) )
+		{
+			seg7_set_brightness( NIGHT_BRIGHTNESS );
+		}
+		else
+		{
+			seg7_set_brightness( SEG7_FULL );
+		}
+	}
+
+	seg_minute = mins;
+	seg_hour = hrs;
+
+	seg7_write( SEGMENT1_ENABLE, SEG7_HEX( mins % 10 ) );
+	seg7_write( SEGMENT2_ENABLE, SEG7_HEX( mins / 10 ) );
+	seg7_write( SEGMENT3_ENABLE, SEG7_HEX( hrs % 10 ) | SEG7_DP );		//Dot separates hours and minutes
+	seg7_write( SEGMENT4_ENABLE, SEG7_HEX( hrs / 10 ) );
+
+	return;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function converts given BCD number to decimal number
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name : bcd_to_dec
+*
+*   Parameters 	  : int num			-	Number to convert to decimal
+*
+*   Return     	  : converted decimal number
+*-------------------------------------------------------------------------------------------------------*/
+
+int bcd_to_dec( int bcd_num )
+{
+	int dec_num = 0 , bit;
+
+	bit = ( (bcd_num >> 4) & 0x0F );
+	dec_num = (dec_num * 10) + bit;		
+	bit = bcd_num % 16;
+	dec_num = (dec_num * 10) + bit;		
+
+	return dec_num;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function converts given decimal number to BCD number
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name : dec_to_bcd
+*
+*   Parameters 	  : int dec_num		-	Number from 0 to 99 to convert to BCD
+*
+*   Return     	  : converted BCD number
+*-------------------------------------------------------------------------------------------------------*/
+
+int dec_to_bcd( int dec_num )
+{
+	return ( ( dec_num / 10 ) << 4 ) | ( dec_num % 10 );
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function displays current time in LCD, only characters which changed since last call are written
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name : lcd_time_display
+*
+*   Parameters : RTC_i2c rtc	-	structure to receive time and date
+*
+*   Return     : PASS
+*-------------------------------------------------------------------------------------------------------*/
+
+int lcd_time_display( RTC_i2c rtc )
+{
+	//Fields are stored in shadow buffer only when they changed, which then marks changed digits
+	if ( ( lcd_shown_valid == 0 ) || ( rtc.hours != lcd_shown.hours ) )
+	{
+		lcd_field_bcd( rtc.hours, LCD_HOURS_POS, LINE1 );
+		lcd_buffer_write( LCD_HOURS_POS + 2, LINE1, ':' );
+	}
+
+	if ( ( lcd_shown_valid == 0 ) || ( rtc.minutes != lcd_shown.minutes ) )
+	{
+		lcd_field_bcd( rtc.minutes, LCD_MINUTES_POS, LINE1 );
+		lcd_buffer_write( LCD_MINUTES_POS + 2, LINE1, ':' );
+	}
+
+	if ( ( lcd_shown_valid == 0 ) || ( rtc.seconds != lcd_shown.seconds ) )
+	{
+		lcd_field_bcd( rtc.seconds, LCD_SECONDS_POS, LINE1 );
+	}
+
+	if ( ( lcd_shown_valid == 0 ) || ( rtc.day != lcd_shown.day ) )
+	{
+		lcd_buffer_printf( lcd_days[ ( rtc.day > SUNDAY ) ? 0 : rtc.day ], LCD_DAY_POS, LINE1 );
+	}
+
+	if ( ( lcd_shown_valid == 0 ) || ( rtc.date != lcd_shown.date ) || ( rtc.month != lcd_shown.month ) || ( rtc.year != lcd_shown.year ) )
+	{
+		lcd_field_bcd( rtc.date, LCD_DATE_POS, LINE2 );
+		lcd_buffer_write( LCD_DATE_POS + 2, LINE2, '/' );
+		lcd_field_bcd( rtc.month, LCD_DATE_POS + 3, LINE2 );
+		lcd_buffer_write( LCD_DATE_POS + 5, LINE2, '/' );
+		lcd_field_bcd( rtc.year, LCD_DATE_POS + 6, LINE2 );
+	}
+
+	lcd_shown = rtc;
+	lcd_shown_valid = 1;
+
+	//Usually one or two characters per second reach the LCD
+	lcd_flush();
+
+	return PASS;
+}
+
+/*--------------------------------------------------------------------------------------------------------
+	Function stores two digits of BCD number in LCD shadow buffer
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name : lcd_field_bcd
+*
+*   Parameters 	  : uint8_t bcd		-	BCD number from 00 to 99
+*					int pos			-	Position of first digit in line
+*					int line		-	Line of digits
+*
+*   Return     	  : NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void lcd_field_bcd( uint8_t bcd, int pos, int line )
+{
+	lcd_buffer_write( pos, line, '0' + ( bcd >> 4 ) );
+	lcd_buffer_write( pos + 1, line, '0' + ( bcd & 0x0F ) );
+
+	return;
+}
+
+/**********************************************************************************************************/
@@ -33,6 +33,7 @@
 
 #include "mario.h"
 #include "lcd.h"
+#include "sched.h"
 
 /*******************************************************************************************************
 									   GLOBAL VARIABLES AND ISRs									
@@ -40,6 +41,33 @@
 
 int  line_mario = LINE2;
 
+//Game state advanced by game_task
+int move_mario = 0, move_obs = LINE_END_OBSTACLE, line_obs = LINE2;
+int obstacle, obs_count;
+int game_phase = MARIO_STAND;
+int game_task_id;
+
+int tick = 100 ; //Initial time in which the game starts running
+
+int score = 0;	//Variable to count score in game
+
+char score_buf[SCORE_SIZE] = "";	//Buffer to store score
+
+//Pixel data for custom characters used in game, glyph cache uploads them to CGRAM when they are drawn
+const unsigned char sprites[SPRITE_COUNT][LCD_GLYPH_SIZE] PROGMEM = 
+{
+	{0x0E, 0x0E, 0x0E, 0x04, 0x1F, 0x04, 0x0A, 0x11},		//Mario
+	{0x0E, 0x0E, 0x0E, 0x04, 0x1F, 0x04, 0x0A, 0x0A},		//Mario running
+	{0x04, 0x15, 0x0E, 0x15, 0x0E, 0x15, 0x0E, 0x04},		//Obstacles
+	{0x04, 0x04, 0x07, 0x14, 0x1C, 0x05, 0x07, 0x04},
+	{0x1F, 0x04, 0x1F, 0x04, 0x04, 0x1F, 0x04, 0x1F},
+	{0x1F, 0x1F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E},
+	{0x0E, 0x1F, 0x15, 0x1F, 0x0E, 0x0E, 0x1B, 0x00},
+	{0x00, 0x04, 0x04, 0x0E, 0x0E, 0x1F, 0x1F, 0x00},
+	{0x1F, 0x11, 0x15, 0x11, 0x1F, 0x11, 0x15, 0x1F},
+	{0x00, 0x04, 0x0E, 0x1F, 0x1F, 0x0E, 0x04, 0x00}
+};
+
 ISR( INT0_vect )
 {
 	if ( line_mario == LINE1 )
@@ -58,160 +86,154 @@ ISR( INT0_vect )
 
 int main(void)
 {
-	int move_mario = 0, move_obs = LINE_END_OBSTACLE, line_obs = LINE2;
-	int obstacle, obs_num, obs_count;
-	
-	int tick = 100 ; //Initial time in which the game starts running
+	initialize_modules();
+
+	//Initializing obstacles
+	obstacle = RANDOM_OBSTACLE ;
+	line_obs = RANDOM_OBS_LINE ;
+	obs_count = RANDOM_OBS_COUNT ;  
 
-	int score = 0;	//Variable to count score in game
+	//Game composes frames in shadow buffer, LCD task sends the changed characters
+	game_task_id = sched_add( game_task, tick, 0 );
+	sched_add( lcd_task, LCD_REFRESH_PERIOD, 0 );
 
-	char *score_buf = NULL;	//Buffer to store score
+	sched_run();
 
-	//Pixel data for custom characters used in game
-	unsigned char mario[8] = {0x0E, 0x0E, 0x0E, 0x04, 0x1F, 0x04, 0x0A, 0x11};
-	unsigned char mario_run[8] = {0x0E, 0x0E, 0x0E, 0x04, 0x1F, 0x04, 0x0A, 0x0A};
-	unsigned char obstacle1[8] = {0x04, 0x15, 0x0E, 0x15, 0x0E, 0x15, 0x0E, 0x04};
-	unsigned char obstacle2[8] = {0x04, 0x04, 0x07, 0x14, 0x1C, 0x05, 0x07, 0x04};
-	unsigned char obstacle3[8] = {0x1F, 0x04, 0x1F, 0x04, 0x04, 0x1F, 0x04, 0x1F};
+	return EXIT_SUCCESS;
+}
 
-	initialize_modules();
+/*******************************************************************************************************
+										  FUNCTION DEFINITIONS 					
+*******************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------
+	Function draws one half of a game frame, mario stands in first half and runs in second half
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	game_task
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
 
-	//Allocating memory for score buffer
-	score_buf = (char *)malloc( SCORE_SIZE * sizeof(char) );
-	if (score_buf == NULL)
+void game_task(void)
+{
+	int obs_num;
+
+	if ( game_phase == MARIO_RUN )
 	{
-		PORTD |= (1 << PD3);
-	}
+		lcd_buffer_write(move_mario, line_mario, SPRITE(MARIO_RUN_DATA));
+		game_phase = MARIO_STAND;
 
-	//Storing game characters at corresponding CGRAM addresses 
-	lcd_create_char( 0, mario );
-	lcd_create_char( 1, mario_run );
-	lcd_create_char( 2, obstacle1 );
-	lcd_create_char( 3, obstacle2 );
-	lcd_create_char( 4, obstacle3 );
+		//Initial display of character walking to its starting position
+		if ( move_mario < STARTING_POSITION )
+		{
+			move_mario++;
+		}
+		else
+		{
+			game_advance();
+		}
 
+		return;
+	}
 
-	//Initial display of character
-	for (move_mario = 0; move_mario < STARTING_POSITION ; move_mario += 1)
+	//Checking if mario hit any obstacle
+	if ( ( move_mario == move_obs ) && ( line_mario == line_obs ) )
 	{
-		lcd_set_cursor(move_mario, LINE2);
-		lcd_data( MARIO_DATA );
-		timer1_delay_ms(100);
-		lcd_set_cursor(move_mario, LINE2);
-		lcd_data( MARIO_RUN_DATA );
-		timer1_delay_ms(100);
-		lcd_command( CLR_SCR );
-		lcd_command( MOVE_TO_BEG_LINE2 );			
+		lcd_buffer_clear();
+		lcd_buffer_printf("    GAME OVER", 0, LINE1);
+		lcd_buffer_printf("  SCORE : ", 0, LINE2);
+		lcd_buffer_printf(score_buf, 10, LINE2);
+
+		sched_set_period( game_task_id, SCHED_SUSPENDED );
+		return;
 	}
 
-	//Initializing obstacles
-	obstacle = RANDOM_OBSTACLE ;
-	line_obs = RANDOM_OBS_LINE ;
-	obs_count = RANDOM_OBS_COUNT ;  
+	//Composing current positions of mario, obstacles and score in shadow buffer
+	lcd_buffer_clear();
+	lcd_glyph_frame_begin();
+	lcd_buffer_write(move_mario, line_mario, SPRITE(MARIO_DATA));
 
-	while(1)
+	if ( move_mario >= STARTING_POSITION )
 	{
-		//Checking if mario hit any obstacle
-		if ( ( move_mario == move_obs ) && ( line_mario == line_obs ) )
+		for (obs_num = 0; obs_num < obs_count; obs_num += 1)
 		{
-			lcd_command( CLR_SCR );
-			lcd_printf("    GAME OVER");
-			lcd_set_cursor(0,2);
-			lcd_printf("  SCORE : ");
-			lcd_printf(score_buf);
-			break;
+			lcd_buffer_write(move_obs + obs_num, line_obs, SPRITE(obstacle));
 		}
 
-		//Displaying current positions of mario and obstacles 
-		lcd_set_cursor(move_mario, line_mario);
-		lcd_data( MARIO_DATA );
+		lcd_buffer_printf(score_buf, SCORE_POS, LINE1);
+	}
 
-		for (obs_num = 0; obs_num < obs_count; obs_num += 1)
-		{
-			lcd_set_cursor(move_obs + obs_num, line_obs);
-			lcd_data( obstacle );			
-		}
-		timer1_delay_ms(tick);
-		lcd_set_cursor(move_mario, line_mario);
-		lcd_data( MARIO_RUN_DATA );
-		timer1_delay_ms(tick);
-		lcd_command( CLR_SCR );
-		lcd_command( MOVE_TO_BEG_LINE2 );
-		move_obs--;
-
-		if (move_obs == 0)
-		{
-			if ( tick != FINAL_GAME_SPEED )
-			{
-				tick = tick - 10;				
-			}
-			
-			//Generating random obstacles			
-			obstacle = RANDOM_OBSTACLE ;
-			line_obs = RANDOM_OBS_LINE ;
-			obs_count = RANDOM_OBS_COUNT ;  
-
-			move_obs = LINE_END_OBSTACLE;
-		}
+	game_phase = MARIO_RUN;
 
-		//Increasing difficulty level of game based on score
-		score++;
+	return;
+}
 
-		if ( score == INCREASE_DIFFICULTY )
-		{
-			move_mario = INC_DIFF;
-		}
-		if ( score == MAX_DIFFICULTY )
+/*--------------------------------------------------------------------------------------------------------
+	Function moves obstacles, updates score and speeds up game
+----------------------------------------------------------------------------------------------------------
+*   
+*   Function Name 	: 	game_advance
+*
+*   Parameters 		:  	NONE
+*
+*   Return     		: 	NONE
+*-------------------------------------------------------------------------------------------------------*/
+
+void game_advance(void)
+{
+	move_obs--;
+
+	if (move_obs == 0)
+	{
+		if ( tick != FINAL_GAME_SPEED )
 		{
-			move_mario = MAX_DIFF;
+			tick = tick - 10;				
+			sched_set_period( game_task_id, tick );
 		}
+		
+		//Generating random obstacles			
+		obstacle = RANDOM_OBSTACLE ;
+		line_obs = RANDOM_OBS_LINE ;
+		obs_count = RANDOM_OBS_COUNT ;  
 
-		//Displaying score
-		lcd_set_cursor(SCORE_POS, LINE1);
-		sprintf(score_buf, "%d", score);
-		lcd_printf(score_buf);
+		move_obs = LINE_END_OBSTACLE;
 	}
 
-	return EXIT_SUCCESS;
-}
+	//Increasing difficulty level of game based on score
+	score++;
 
-/*******************************************************************************************************
-										  FUNCTION DEFINITIONS 					
-*******************************************************************************************************/
+	if ( score == INCREASE_DIFFICULTY )
+	{
+		move_mario = INC_DIFF;
+	}
+	if ( score == MAX_DIFFICULTY )
+	{
+		move_mario = MAX_DIFF;
+	}
+
+	//Updating score to be displayed in next frame
+	sprintf(score_buf, "%d", score);
+
+	return;
+}
 
 /*--------------------------------------------------------------------------------------------------------
-	Function generates time delay with given user time ( in ms )
+	Function sends characters changed in shadow buffer to LCD
 ----------------------------------------------------------------------------------------------------------
 *   
-*   Function Name : timer1_delay_ms
+*   Function Name 	: 	lcd_task
 *
-*   Parameters : long int delay_ms	-	Delay to generate ( in ms )
+*   Parameters 		:  	NONE
 *
-*   Return     : NONE
+*   Return     		: 	NONE
 *-------------------------------------------------------------------------------------------------------*/
 
-void timer1_delay_ms(long int delay_ms)
+void lcd_task(void)
 {
-	/*	We are setting prescalar as 1024
-	 *	so clock value for timer will be Fosc / 1024 = 7812.5Hz ( Fosc = 8MHz )
-	 *	time taken for one cycle = 1 / 7812.5 = 0.128 ms
-	 *	
-	 *	=> TCNT value = ( delay_ms / 0.128ms )
-	 *	
-	 *	Since timer is 8 bit, we can have TCNT value only upto 255 
-	 *	We have to loop the TCNT value for quotient number of times and then load the remainder 
-	 *	for the final iteration 																	*/ 
-
-	TCNT1 = TCNT1_MAX - ( delay_ms / ONE_COUNT_TIME_1024 );	
-							
-	TCCR1A = CLEAR_ALL;
-	TCCR1B |= SET_PRESCALAR_1024;
-
-	while( ( TIFR & ( 1 << TOV1 ) ) == 0 );		//Waiting until overflow occurs
-
-	TCCR1B = CLEAR_ALL;
-	TIFR = ( 1 << TOV1 );
-
+	lcd_flush();
 	return;
 }
 
@@ -242,6 +264,10 @@ void initialize_modules(void)
 
 	//LCD configurations		
 	lcd_init();	
+	lcd_buffer_init();
+
+	clock_init();					//Starting millis() and micros() time base on Timer2
+	sched_init();					//Starting 1ms scheduler tick on Timer1
 
 	return;
 }
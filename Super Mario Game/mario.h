@@ -22,14 +22,6 @@
 #define INT0_ENABLE				( 1 << INT0 )
 #define INT0_RISING_EDGE_TRIG	( 1 << ISC00 ) | ( 1 << ISC01 )
 
-//Timer specific macros
-#define TCNT1_MAX				65535
-#define TCNT_MAX				255
-#define TCNT_MIN				0
-#define ONE_COUNT_TIME_1024		0.128
-#define SET_PRESCALAR_1024		( 1 << CS00 ) | ( 1 << CS02 )
-#define STOP_TIMER				0x00
-
 #define INCREMENT(x)	x++
 #define DECREMENT(x)	x--
 
@@ -41,7 +33,12 @@
 #define OBSTACLE2_DATA			3
 #define OBSTACLE3_DATA			4
 
-#define RANDOM_OBSTACLE			( rand() % 3 ) + 2
+#define OBSTACLE_COUNT			8
+#define SPRITE_COUNT			( OBSTACLE1_DATA + OBSTACLE_COUNT )
+
+#define SPRITE(id)				lcd_glyph( (id), &sprites[0][0] )
+
+#define RANDOM_OBSTACLE			( rand() % OBSTACLE_COUNT ) + OBSTACLE1_DATA
 #define RANDOM_OBS_LINE			( rand() % 2 ) + 1 
 #define RANDOM_OBS_COUNT		( rand() % 4 ) + 1
 
@@ -50,6 +47,11 @@
 #define SCORE_SIZE				5
 #define SCORE_POS				12
 
+#define MARIO_STAND				0			//Half of frame in which mario stands
+#define MARIO_RUN				1			//Half of frame in which mario runs
+
+#define LCD_REFRESH_PERIOD		10			//Time between LCD updates ( in ms )
+
 #define GAME_PAUSE				0
 #define GAME_START				1
 
@@ -65,15 +67,11 @@
 										  FUNCTION PROTOTYPES 					
 *******************************************************************************************************/
 
-void timer1_delay_ms(long int);
+void game_task(void);
+void game_advance(void);
+void lcd_task(void);
 void initialize_modules(void);
 
-void lcd_init(void);
-void lcd_command(unsigned char);
-void lcd_data(unsigned char);
-void lcd_printf(char*);
-void lcd_create_char(int, unsigned char*);
-void lcd_set_cursor(int,int);
 void clear_data(void);
 
 /*********************************************************************************************************/